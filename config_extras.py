@@ -1 +1,12 @@
 Import("env", "projenv")
+
+import os
+import sys
+
+# dictionary of the binary log format strings, for tools/logdecode.py
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+import logdecode
+
+logdecode.write_dictionary(
+    [env.subst("$PROJECT_SRC_DIR"), os.path.join(env.subst("$PROJECT_DIR"), "lib")],
+    os.path.join(env.subst("$BUILD_DIR"), "logformats.json"))
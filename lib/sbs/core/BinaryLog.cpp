@@ -0,0 +1,265 @@
+/**
+ * @file BinaryLog.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "BinaryLog.h"
+#include "LogSink.h"
+#include "time/timing.h"
+#include <string.h>
+
+namespace sbs::io {
+
+/// If records are sent instead of text
+static bool binaryOutput = false;
+
+LogRecord::LogRecord(const Verbosity& level, uint32_t id) {
+    buffer[0] = sync;
+    buffer[1] = static_cast<uint8_t>(level);
+    memcpy(buffer + 2, &id, 4);
+    const LogStamp stamp = getLogStamp();
+    if (!binaryOutput || stamp == LogStamp::None) return;
+    if ((static_cast<uint8_t>(stamp) & static_cast<uint8_t>(LogStamp::Time)) != 0) {
+        const uint64_t now = time::micros64();
+        memcpy(buffer + headerSize, &now, 8);
+        buffer[1] |= timeStamped;
+        length += 8;
+    }
+    if ((static_cast<uint8_t>(stamp) & static_cast<uint8_t>(LogStamp::Sequence)) != 0) {
+        const uint16_t number = nextLogSequence();
+        memcpy(buffer + headerSize + length, &number, 2);
+        buffer[1] |= sequenced;
+        length += 2;
+    }
+}
+
+void LogRecord::addRaw(uint8_t type, const void* value, uint8_t size) {
+    // after a truncation, a smaller argument would be decoded in the wrong place of the format
+    if ((buffer[1] & truncated) != 0) return;
+    if (length + 1 + size > SBS_BLOG_PAYLOAD_SIZE + stampSize(buffer)) {
+        buffer[1] |= truncated;
+        return;
+    }
+    buffer[headerSize + length] = type;
+    memcpy(buffer + headerSize + length + 1, value, size);
+    length += 1 + size;
+}
+
+void LogRecord::add(const char* value) {
+    if ((buffer[1] & truncated) != 0) return;
+    const uint8_t capacity = SBS_BLOG_PAYLOAD_SIZE + stampSize(buffer);
+    if (length + 2 > capacity) {
+        buffer[1] |= truncated;
+        return;
+    }
+    size_t size = strlen(value);
+    if (size > static_cast<size_t>(capacity - length - 2)) {
+        size = capacity - length - 2;
+        buffer[1] |= truncated;
+    }
+    buffer[headerSize + length]     = kindString;
+    buffer[headerSize + length + 1] = static_cast<uint8_t>(size);
+    memcpy(buffer + headerSize + length + 2, value, size);
+    length += 2 + size;
+}
+
+uint8_t LogRecord::close() {
+    buffer[headerSize - 1] = length;
+    uint8_t sum            = 0;
+    for (uint8_t i = 1; i < headerSize + length; ++i)
+        sum = static_cast<uint8_t>(sum + buffer[i]);
+    buffer[headerSize + length] = sum;
+    return headerSize + length + 1;
+}
+
+void setBinaryLog(bool binary) {
+    binaryOutput = binary;
+}
+
+bool isBinaryLog() {
+    return binaryOutput;
+}
+
+void sendRecord(const LogRecord& record, const char* format) {
+    if (binaryOutput) {
+        const uint8_t* data = record.data();
+        logRecord(data, LogRecord::headerSize + data[LogRecord::headerSize - 1] + 1, static_cast<Verbosity>(data[1] & 0x03));
+        return;
+    }
+    printRecord(record.data(), format);
+}
+
+/**
+ * @brief Print a string at the given level
+ * @param level The message's level
+ * @param str The string
+ */
+static void printText(const Verbosity& level, const char* str) {
+    switch (level) {
+        case Verbosity::Error: error(str); break;
+        case Verbosity::Warning: warning(str); break;
+        case Verbosity::Debug: debug(str); break;
+        default: logger(str); break;
+    }
+}
+
+/**
+ * @brief Print an integer at the given level
+ * @tparam T The integer type
+ * @param level The message's level
+ * @param value The integer
+ * @param format The integer format
+ */
+template<class T>
+static void printInteger(const Verbosity& level, T value, const IntFormat& format) {
+    switch (level) {
+        case Verbosity::Error: error(value, format); break;
+        case Verbosity::Warning: warning(value, format); break;
+        case Verbosity::Debug: debug(value, format); break;
+        default: logger(value, format); break;
+    }
+}
+
+/**
+ * @brief Print a floating point value at the given level
+ * @param level The message's level
+ * @param value The value
+ * @param digit Number of decimals
+ */
+static void printFloat(const Verbosity& level, double value, uint8_t digit) {
+    switch (level) {
+        case Verbosity::Error: error(value, digit); break;
+        case Verbosity::Warning: warning(value, digit); break;
+        case Verbosity::Debug: debug(value, digit); break;
+        default: logger(value, digit); break;
+    }
+}
+
+/**
+ * @brief Terminate the line at the given level
+ * @param level The message's level
+ */
+static void printEnd(const Verbosity& level) {
+    switch (level) {
+        case Verbosity::Error: errorln(); break;
+        case Verbosity::Warning: warningln(); break;
+        case Verbosity::Debug: debugln(); break;
+        default: loggerln(); break;
+    }
+}
+
+/**
+ * @brief Print one argument of a payload
+ * @param level The message's level
+ * @param argument The argument (type byte first)
+ * @param format The integer format
+ * @param digit Number of decimals for floating point values
+ * @return The argument size in the payload
+ */
+static uint8_t printArgument(const Verbosity& level, const uint8_t* argument, const IntFormat& format, uint8_t digit) {
+    const uint8_t kind = argument[0] & 0xF0;
+    const uint8_t size = argument[0] & 0x0F;
+    const uint8_t* raw = argument + 1;
+    if (kind == LogRecord::kindString) {
+        char str[SBS_BLOG_PAYLOAD_SIZE];
+        memcpy(str, raw + 1, raw[0]);
+        str[raw[0]] = '\0';
+        printText(level, str);
+        return 2 + raw[0];
+    }
+    if (kind == LogRecord::kindFloat) {
+        if (size == sizeof(double)) {
+            double value;
+            memcpy(&value, raw, size);
+            printFloat(level, value, digit);
+        } else if (size == sizeof(float)) {
+            float value;
+            memcpy(&value, raw, size);
+            printFloat(level, static_cast<double>(value), digit);
+        }
+        return 1 + size;
+    }
+    const bool isSigned = kind == LogRecord::kindSigned;
+    switch (size) {
+        case 1: {
+            uint8_t value = raw[0];
+            if (isSigned) printInteger(level, static_cast<int8_t>(value), format);
+            else printInteger(level, value, format);
+            break;
+        }
+        case 2: {
+            uint16_t value;
+            memcpy(&value, raw, size);
+            if (isSigned) printInteger(level, static_cast<int16_t>(value), format);
+            else printInteger(level, value, format);
+            break;
+        }
+        case 4: {
+            uint32_t value;
+            memcpy(&value, raw, size);
+            if (isSigned) printInteger(level, static_cast<int32_t>(value), format);
+            else printInteger(level, value, format);
+            break;
+        }
+        default: {
+            uint64_t value;
+            memcpy(&value, raw, sizeof(uint64_t));
+            if (isSigned) printInteger(level, static_cast<int64_t>(value), format);
+            else printInteger(level, value, format);
+            break;
+        }
+    }
+    return 1 + size;
+}
+
+void printRecord(const uint8_t* record, const char* format) {
+    const auto level    = static_cast<Verbosity>(record[1] & 0x03);
+    const uint8_t* next = record + LogRecord::headerSize + LogRecord::stampSize(record);
+    const uint8_t* end  = record + LogRecord::headerSize + record[LogRecord::headerSize - 1];
+    if (format == nullptr) {
+        uint32_t id;
+        memcpy(&id, record + 2, 4);
+        printText(level, "#");
+        printInteger(level, id, IntFormat::Hexadecimal);
+    } else {
+        char literal[16];
+        uint8_t literalLength = 0;
+        auto flushLiteral     = [&]() {
+            if (literalLength == 0) return;
+            literal[literalLength] = '\0';
+            printText(level, literal);
+            literalLength = 0;
+        };
+        while (*format != '\0') {
+            if (*format != '{') {
+                literal[literalLength++] = *format++;
+                if (literalLength == sizeof(literal) - 1) flushLiteral();
+                continue;
+            }
+            flushLiteral();
+            IntFormat intFormat = IntFormat::Auto;
+            uint8_t digit       = 2;
+            ++format;
+            if (*format == 'x') intFormat = IntFormat::Hexadecimal;
+            if (*format == 'b') intFormat = IntFormat::Binary;
+            if (*format == '.' && format[1] >= '0' && format[1] <= '9') digit = static_cast<uint8_t>(format[1] - '0');
+            while (*format != '\0' && *format != '}') ++format;
+            if (*format == '}') ++format;
+            if (next < end) next += printArgument(level, next, intFormat, digit);
+        }
+        flushLiteral();
+    }
+    // unused arguments
+    while (next < end) {
+        printText(level, " ");
+        next += printArgument(level, next, IntFormat::Auto, 2);
+    }
+    if ((record[1] & LogRecord::truncated) != 0)
+        printText(level, " [...]");
+    printEnd(level);
+}
+
+}// namespace sbs::io
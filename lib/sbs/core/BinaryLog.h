@@ -0,0 +1,242 @@
+/**
+ * @file BinaryLog.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "Print.h"
+
+/// Maximum size of the arguments of one binary record
+#ifndef SBS_BLOG_PAYLOAD_SIZE
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_BLOG_PAYLOAD_SIZE 24
+#else
+#define SBS_BLOG_PAYLOAD_SIZE 48
+#endif
+#endif
+
+/**
+ * @brief Log a message as a compact binary record
+ *
+ * The format string is identified by its hash, computed at compile time; only the
+ * identifier and the raw arguments are sent. Placeholders: `{}` default, `{x}` hexadecimal,
+ * `{b}` binary, `{.N}` N decimals. The format strings are extracted from the sources by
+ * `tools/logdecode.py`, which also decodes the stream on the host.
+ *
+ * Define SBS_BLOG_NO_FORMAT to keep the format strings out of the binary (the text
+ * fallback then prints the identifier and the raw arguments). Messages above
+ * SBS_LOG_LOCAL_LEVEL are removed at compile time.
+ */
+#define SBS_BLOG(level, format, ...)                                                                                             \
+    do {                                                                                                                         \
+        if (static_cast<int>(level) <= SBS_LOG_LOCAL_LEVEL)                                                                      \
+            ::sbs::io::binaryLog(level, ::sbs::io::FormatId<::sbs::io::formatId(format)>::value, SBS_BLOG_FORMAT(format), ##__VA_ARGS__); \
+    } while (0)
+
+#ifdef SBS_BLOG_NO_FORMAT
+#define SBS_BLOG_FORMAT(format) nullptr
+#else
+#define SBS_BLOG_FORMAT(format) format
+#endif
+
+namespace sbs::io {
+
+/**
+ * @brief Compute the identifier of a format string (32 bits FNV-1a)
+ * @param format The format string
+ * @param hash Hash of the previous characters
+ * @return The identifier
+ */
+constexpr uint32_t formatId(const char* format, uint32_t hash = 2166136261UL) {
+    return *format == '\0' ? hash : formatId(format + 1, (hash ^ static_cast<uint8_t>(*format)) * 16777619UL);
+}
+
+/**
+ * @brief Force the compile-time evaluation of a format identifier
+ * @tparam Id The identifier
+ */
+template<uint32_t Id>
+struct FormatId {
+    static constexpr uint32_t value = Id;///< The identifier
+};
+
+/**
+ * @brief A binary log record
+ *
+ * Layout: sync byte, level/flags byte, identifier (4 bytes), payload size, payload,
+ * checksum (sum of the bytes between sync and checksum). Each argument of the payload is a
+ * type byte (kind in the high nibble, size in the low nibble) followed by its little-endian
+ * value; strings carry their length after the type byte. When the binary output is
+ * active, the stamps selected by setLogStamp are put before the arguments.
+ */
+class LogRecord {
+public:
+    /// First byte of every record
+    static constexpr uint8_t sync = 0xA5;
+    /// Size of the record header
+    static constexpr uint8_t headerSize = 7;
+    /// Flag: an argument did not fit in the payload (the next ones are dropped)
+    static constexpr uint8_t truncated = 0x80;
+    /// Flag: the payload starts with the time in microseconds (8 bytes)
+    static constexpr uint8_t timeStamped = 0x40;
+    /// Flag: the payload starts (after the time) with the sequence number (2 bytes)
+    static constexpr uint8_t sequenced = 0x20;
+    /// Maximum size of the stamps
+    static constexpr uint8_t maxStampSize = 10;
+    /// Argument kind: unsigned integer
+    static constexpr uint8_t kindUnsigned = 0x00;
+    /// Argument kind: signed integer
+    static constexpr uint8_t kindSigned = 0x10;
+    /// Argument kind: floating point
+    static constexpr uint8_t kindFloat = 0x20;
+    /// Argument kind: string
+    static constexpr uint8_t kindString = 0x30;
+
+    /**
+     * @brief Constructor
+     * @param level The message's level
+     * @param id The format identifier
+     */
+    LogRecord(const Verbosity& level, uint32_t id);
+
+    /**
+     * @brief Add an integer argument
+     * @tparam T The integer type
+     * @param value The value
+     */
+    template<class T>
+    void add(T value) {
+        addRaw(static_cast<uint8_t>((static_cast<T>(-1) < static_cast<T>(0) ? kindSigned : kindUnsigned) | sizeof(T)), &value, sizeof(T));
+    }
+
+    /**
+     * @brief Add a float argument
+     * @param value The value
+     */
+    void add(float value) { addRaw(kindFloat | sizeof(float), &value, sizeof(float)); }
+
+    /**
+     * @brief Add a double argument
+     * @param value The value
+     */
+    void add(double value) { addRaw(static_cast<uint8_t>(kindFloat | sizeof(double)), &value, sizeof(double)); }
+
+    /**
+     * @brief Add a string argument (truncated to what fits)
+     * @param value The value
+     */
+    void add(const char* value);
+
+    /**
+     * @brief Add a string argument (truncated to what fits)
+     * @param value The value
+     */
+    void add(char* value) { add(static_cast<const char*>(value)); }
+
+    /**
+     * @brief Add a string argument (truncated to what fits)
+     * @param value The value
+     */
+    void add(const string& value) { add(value.c_str()); }
+
+    /**
+     * @brief Size of the stamps at the beginning of the payload
+     * @param record The record bytes
+     * @return The stamps size
+     */
+    [[nodiscard]] static uint8_t stampSize(const uint8_t* record) {
+        return ((record[1] & timeStamped) != 0 ? 8 : 0) + ((record[1] & sequenced) != 0 ? 2 : 0);
+    }
+
+    /**
+     * @brief Finalize the record
+     * @return The total record size
+     */
+    uint8_t close();
+
+    /**
+     * @brief Access to the raw record
+     * @return The record bytes
+     */
+    [[nodiscard]] const uint8_t* data() const { return buffer; }
+
+private:
+    /// Record bytes
+    uint8_t buffer[headerSize + maxStampSize + SBS_BLOG_PAYLOAD_SIZE + 1] = {};
+    /// Payload size
+    uint8_t length = 0;
+    /**
+     * @brief Add an argument
+     * @param type The type byte
+     * @param value The raw value
+     * @param size The value size
+     */
+    void addRaw(uint8_t type, const void* value, uint8_t size);
+};
+
+/**
+ * @brief Activate the binary output of SBS_BLOG messages
+ * @param binary If records are sent instead of text
+ */
+void setBinaryLog(bool binary);
+
+/**
+ * @brief Check for the binary output
+ * @return True if SBS_BLOG messages are sent as records
+ */
+[[nodiscard]] bool isBinaryLog();
+
+/**
+ * @brief Send a closed record, or print it as text if the binary output is not active
+ * @param record The closed record
+ * @param format The format string (may be nullptr)
+ */
+void sendRecord(const LogRecord& record, const char* format);
+
+/**
+ * @brief Print a record as text
+ * @param record The record bytes
+ * @param format The format string (may be nullptr)
+ */
+void printRecord(const uint8_t* record, const char* format);
+
+/**
+ * @brief Stop argument recursion
+ */
+inline void addArguments(LogRecord&) {}
+
+/**
+ * @brief Add the arguments to a record
+ * @tparam First Type of the first argument
+ * @tparam Rest Types of the other arguments
+ * @param record The record
+ * @param first The first argument
+ * @param rest The other arguments
+ */
+template<class First, class... Rest>
+void addArguments(LogRecord& record, const First& first, const Rest&... rest) {
+    record.add(first);
+    addArguments(record, rest...);
+}
+
+/**
+ * @brief Log a message (use the SBS_BLOG macro)
+ * @tparam Args Types of the arguments
+ * @param level The message's level
+ * @param id The format identifier
+ * @param format The format string (may be nullptr)
+ * @param args The arguments
+ */
+template<class... Args>
+void binaryLog(const Verbosity& level, uint32_t id, const char* format, const Args&... args) {
+    if (!isLogged(level)) return;
+    LogRecord record(level, id);
+    addArguments(record, args...);
+    record.close();
+    sendRecord(record, format);
+}
+
+}// namespace sbs::io
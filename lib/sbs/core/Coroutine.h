@@ -0,0 +1,119 @@
+/**
+ * @file Coroutine.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "time/timing.h"
+
+/**
+ * @brief Begin the body of a coroutine
+ * @param co The coroutine state (sbs::Coroutine)
+ *
+ * A coroutine is a function returning bool, whose body is enclosed between SBS_CO_BEGIN
+ * and SBS_CO_END. It returns false while the sequence waits, and true once the sequence
+ * is complete; the next call starts the sequence again.
+ *
+ * The coroutine is stackless: local variables do not survive a wait, keep the state in
+ * members. The wait macros cannot be used inside a switch statement of the body.
+ */
+#define SBS_CO_BEGIN(co)        \
+    switch ((co).resumePoint) { \
+    case 0:
+
+/**
+ * @brief Give the hand back, resume at the next call
+ * @param co The coroutine state
+ */
+#define SBS_CO_YIELD(co)             \
+    do {                             \
+        (co).resumePoint = __LINE__; \
+        return false;                \
+    case __LINE__:;                  \
+    } while (0)
+
+/**
+ * @brief Give the hand back until a condition is true (checked at each call)
+ * @param co The coroutine state
+ * @param condition The condition
+ */
+#define SBS_CO_WAIT_UNTIL(co, condition) \
+    do {                                 \
+        (co).resumePoint = __LINE__;     \
+        [[fallthrough]];                 \
+    case __LINE__:                       \
+        if (!(condition)) return false;  \
+    } while (0)
+
+/**
+ * @brief Give the hand back for a duration
+ * @param co The coroutine state
+ * @param milli The duration in milliseconds
+ */
+#define SBS_CO_DELAY(co, milli)                     \
+    do {                                            \
+        (co).startDelay(milli);                     \
+        SBS_CO_WAIT_UNTIL(co, (co).delayElapsed()); \
+    } while (0)
+
+/**
+ * @brief End the body of a coroutine
+ * @param co The coroutine state
+ */
+#define SBS_CO_END(co)    \
+    }                     \
+    (co).resumePoint = 0; \
+    return true
+
+namespace sbs {
+
+/**
+ * @brief State of a stackless coroutine (protothread)
+ *
+ * Lets a multi-step sequence (trigger, wait, poll, read) be written linearly while
+ * giving the hand back to the scheduler at each wait. The state is the resume point
+ * and the end of the current delay.
+ */
+class Coroutine {
+public:
+    /**
+     * @brief Restart the sequence from its beginning at next call
+     */
+    void reset() { resumePoint = 0; }
+
+    /**
+     * @brief Check if the sequence is waiting
+     * @return True if started and not complete
+     */
+    [[nodiscard]] bool isRunning() const { return resumePoint != 0; }
+
+    /**
+     * @brief Start a delay
+     * @param milli The duration in milliseconds
+     */
+    void startDelay(uint32_t milli) { wakeTime = time::millis() + milli; }
+
+    /**
+     * @brief Check the end of the delay
+     * @return True if the delay is elapsed
+     */
+    [[nodiscard]] bool delayElapsed() const { return !time::isBefore(time::millis(), wakeTime); }
+
+    /**
+     * @brief Time until the end of the delay
+     * @return Remaining milliseconds (0 if elapsed)
+     */
+    [[nodiscard]] uint32_t remainingDelay() const { return delayElapsed() ? 0 : wakeTime - time::millis(); }
+
+    /// Resume point (source line), 0 at the beginning
+    uint16_t resumePoint = 0;
+
+private:
+    /// End of the current delay
+    uint32_t wakeTime = 0;
+};
+
+}// namespace sbs
@@ -0,0 +1,214 @@
+/**
+ * @file EventLoop.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "EventLoop.h"
+#include "Node.h"
+#include "time/Sleep.h"
+#include "time/timing.h"
+#ifndef NATIVE
+#include <Arduino.h>
+#endif
+
+namespace sbs {
+
+#ifndef NATIVE
+/**
+ * @brief Interrupts masked during the life of the object (state restored at the end)
+ */
+class InterruptLock {
+public:
+#if defined(ARDUINO_ARCH_AVR)
+    InterruptLock() :
+        state{SREG} { cli(); }
+    ~InterruptLock() { SREG = state; }
+#elif defined(ARDUINO_ARCH_SAMD)
+    InterruptLock() :
+        state{__get_PRIMASK()} { __disable_irq(); }
+    ~InterruptLock() { __set_PRIMASK(state); }
+#else
+    InterruptLock() :
+        state{xt_rsil(15)} {}
+    ~InterruptLock() { xt_wsr_ps(state); }
+#endif
+    InterruptLock(const InterruptLock&)            = delete;
+    InterruptLock& operator=(const InterruptLock&) = delete;
+
+private:
+#ifdef ARDUINO_ARCH_AVR
+    /// Saved status register
+    uint8_t state;
+#else
+    /// Saved interrupt mask
+    uint32_t state;
+#endif
+};
+#endif
+
+EventQueue::EventQueue() {
+    for (uint16_t i = 0; i < capacity; ++i)
+        cells[i].sequence = i;
+    enqueue = 0;
+    dequeue = 0;
+}
+
+bool EventQueue::push(const Event& event) {
+#ifdef NATIVE
+    uint32_t position = enqueue.load(std::memory_order_relaxed);
+    Cell* cell        = nullptr;
+    for (;;) {
+        cell                    = &cells[position & (capacity - 1U)];
+        const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference   = static_cast<int32_t>(sequence - position);
+        if (difference == 0) {
+            // the cell is free: reserve it
+            if (enqueue.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            // the consumer has not freed the cell yet: full
+            return false;
+        } else {
+            position = enqueue.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event = event;
+    cell->sequence.store(position + 1U, std::memory_order_release);
+    return true;
+#else
+    const InterruptLock lock;
+    const uint16_t position = enqueue;
+    Cell& cell              = cells[position & (capacity - 1U)];
+    if (cell.sequence != position) return false;
+    cell.event    = event;
+    cell.sequence = position + 1U;
+    enqueue       = position + 1U;
+    return true;
+#endif
+}
+
+bool EventQueue::pop(Event& event) {
+#ifdef NATIVE
+    const uint32_t position = dequeue.load(std::memory_order_relaxed);
+    Cell& cell              = cells[position & (capacity - 1U)];
+    if (cell.sequence.load(std::memory_order_acquire) != position + 1U) return false;
+    event = cell.event;
+    cell.sequence.store(position + capacity, std::memory_order_release);
+    dequeue.store(position + 1U, std::memory_order_relaxed);
+    return true;
+#else
+    // the 16-bit accesses are not atomic on AVR
+    const InterruptLock lock;
+    const uint16_t position = dequeue;
+    Cell& cell              = cells[position & (capacity - 1U)];
+    if (cell.sequence != static_cast<uint16_t>(position + 1U)) return false;
+    event = cell.event;
+    // the cell is free for the producer one turn later
+    cell.sequence = position + capacity;
+    dequeue       = position + 1U;
+    return true;
+#endif
+}
+
+bool EventQueue::empty() const {
+#ifdef NATIVE
+    const uint32_t position = dequeue.load(std::memory_order_relaxed);
+    return cells[position & (capacity - 1U)].sequence.load(std::memory_order_acquire) != position + 1U;
+#else
+    const InterruptLock lock;
+    const uint16_t position = dequeue;
+    return cells[position & (capacity - 1U)].sequence != static_cast<uint16_t>(position + 1U);
+#endif
+}
+
+bool EventLoop::setHandler(EventType type, Handler handler, void* context) {
+    if (type >= maxTypes) return false;
+    types[type].handler = handler;
+    types[type].context = context;
+    return true;
+}
+
+bool EventLoop::post(EventType type, uint16_t value, uint32_t data) {
+    if (type >= maxTypes) return false;
+    Event event;
+    event.type   = type;
+    event.value  = value;
+    event.data   = data;
+    // the 32-bit counter, safe in interrupts: only differences of dates are used
+    event.posted = time::micros();
+    if (!queue.push(event)) {
+        ++dropped;
+        return false;
+    }
+    // the flag of this loop, not the sleep state of the posting node
+    wakeRequested = true;
+    return true;
+}
+
+void EventLoop::timerEvent(void* type) {
+    events().post(static_cast<EventType>(reinterpret_cast<uintptr_t>(type)));
+}
+
+bool EventLoop::addSource(Source source) {
+    for (auto& slot : sources) {
+        if (slot == source) return true;
+        if (slot == nullptr) {
+            slot = source;
+            return true;
+        }
+    }
+    return false;
+}
+
+void EventLoop::poll() {
+    for (const auto& source : sources) {
+        if (source != nullptr) source();
+    }
+}
+
+uint16_t EventLoop::dispatch() {
+    uint16_t handled = 0;
+    Event event;
+    // bounded: a handler posting events cannot stall the main loop
+    while (handled < EventQueue::capacity && queue.pop(event)) {
+        TypeData& type         = types[event.type];
+        const uint32_t latency = time::micros() - event.posted;
+        ++type.count;
+        type.latency += latency;
+        if (latency > type.maxLatency) type.maxLatency = latency;
+        if (type.handler != nullptr) type.handler(event, type.context);
+        ++handled;
+    }
+    return handled;
+}
+
+bool EventLoop::takeWakeUp() {
+    // cleared only when set: a post between the test and the clear changes nothing
+    if (!wakeRequested) return false;
+    wakeRequested = false;
+    return true;
+}
+
+uint32_t EventLoop::getMeanLatency(EventType type) const {
+    if (getCount(type) == 0) return 0;
+    return static_cast<uint32_t>(types[type].latency / types[type].count);
+}
+
+void EventLoop::resetStats() {
+    for (auto& type : types) {
+        type.count      = 0;
+        type.maxLatency = 0;
+        type.latency    = 0;
+    }
+}
+
+/// The event loop of the main loop
+static NodeLocal<EventLoop> mainEvents;
+
+EventLoop& events() {
+    return mainEvents.get();
+}
+
+}// namespace sbs
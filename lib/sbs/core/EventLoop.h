@@ -0,0 +1,280 @@
+/**
+ * @file EventLoop.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+#ifdef NATIVE
+#include <atomic>
+#endif
+
+/// Number of event types
+#ifndef SBS_EVENT_TYPES
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_EVENT_TYPES 8
+#else
+#define SBS_EVENT_TYPES 32
+#endif
+#endif
+/// Capacity of the event queue (power of 2)
+#ifndef SBS_EVENT_QUEUE
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_EVENT_QUEUE 16
+#else
+#define SBS_EVENT_QUEUE 64
+#endif
+#endif
+/// Maximum number of polled event sources
+#ifndef SBS_EVENT_SOURCES
+#define SBS_EVENT_SOURCES 4
+#endif
+
+namespace sbs {
+
+/// Type of an event
+using EventType = uint8_t;
+
+/**
+ * @brief Event types of the library (the application uses the types from User)
+ */
+namespace SystemEvent {
+/// Data received on the serial port
+constexpr EventType SerialRx = 0;
+/// Change of the network status (value: the new net::Wifi::Status)
+constexpr EventType Network = 1;
+/// First type free for the application
+constexpr EventType User = 4;
+}// namespace SystemEvent
+
+/**
+ * @brief A posted event
+ */
+struct Event {
+    EventType type  = 0;///< Type of the event
+    uint16_t value  = 0;///< Small payload
+    uint32_t data   = 0;///< Payload
+    uint32_t posted = 0;///< Time of the post in microseconds
+};
+
+/**
+ * @brief Queue of events between interrupts and the main loop
+ *
+ * Many producers (interrupt routines, timer callbacks, other threads on native), one
+ * consumer (the main loop). Each cell carries a sequence number (bounded MPMC queue of
+ * D. Vyukov): on native, producers reserve their cell with a compare-and-swap and never
+ * block each other. The single-core targets have no compare-and-swap instruction: the
+ * reservation and the copy of the event run with interrupts masked for a few cycles.
+ */
+class EventQueue {
+public:
+    /// Capacity of the queue
+    static constexpr uint16_t capacity = SBS_EVENT_QUEUE;
+    static_assert((capacity & (capacity - 1)) == 0, "Event queue capacity must be a power of 2");
+
+    EventQueue();
+
+    /**
+     * @brief Add an event (interrupt safe)
+     * @param event The event
+     * @return False if the queue is full
+     */
+    bool push(const Event& event);
+
+    /**
+     * @brief Take the oldest event (main loop only)
+     * @param event Output: the event
+     * @return False if the queue is empty
+     */
+    bool pop(Event& event);
+
+    /**
+     * @brief Check for queued events
+     * @return True if empty
+     */
+    [[nodiscard]] bool empty() const;
+
+private:
+#ifdef NATIVE
+    /// Position counter
+    using Position = std::atomic<uint32_t>;
+#else
+    /// Position counter
+    using Position = volatile uint16_t;
+#endif
+    /**
+     * @brief A cell of the queue
+     */
+    struct Cell {
+        Position sequence;///< Position expected by the next producer (or by the consumer, plus one)
+        Event event;      ///< The event
+    };
+    /// The cells
+    Cell cells[capacity];
+    /// Next position to write
+    Position enqueue;
+    /// Next position to read
+    Position dequeue;
+};
+
+/**
+ * @brief Event loop
+ *
+ * Interrupts, timers, the serial port and the network post lightweight events; the main
+ * loop dispatches them to the handlers of their types, and sleeps when there is no event
+ * nor due task (a post wakes it up). Polled sources (functions checking a peripheral) are
+ * called at each loop iteration and during the sleep.
+ *
+ * The latency of each event type (time from the post to the start of the handler) is
+ * measured in microseconds.
+ */
+class EventLoop {
+public:
+    /// Function handling an event
+    using Handler = void (*)(const Event& event, void* context);
+    /// Function checking a peripheral and posting events
+    using Source = void (*)();
+    /// Number of event types
+    static constexpr uint8_t maxTypes = SBS_EVENT_TYPES;
+    /// Maximum number of sources
+    static constexpr uint8_t maxSources = SBS_EVENT_SOURCES;
+
+    /**
+     * @brief Define the handler of an event type
+     * @param type The type
+     * @param handler The handler (nullptr to ignore the type)
+     * @param context Argument of the handler
+     * @return False if the type is invalid
+     */
+    bool setHandler(EventType type, Handler handler, void* context = nullptr);
+
+    /**
+     * @brief Post an event (interrupt safe)
+     * @param type The type
+     * @param value Small payload
+     * @param data Payload
+     * @return False if the queue is full (the event is counted as dropped)
+     */
+    bool post(EventType type, uint16_t value = 0, uint32_t data = 0);
+
+    /**
+     * @brief Timer callback posting an event (see time::TimerWheel)
+     * @param type The event type, given by typeContext()
+     */
+    static void timerEvent(void* type);
+
+    /**
+     * @brief Timer context for timerEvent
+     * @param type The event type
+     * @return The context
+     */
+    static void* typeContext(EventType type) { return reinterpret_cast<void*>(static_cast<uintptr_t>(type)); }
+
+    /**
+     * @brief Add a polled source
+     * @param source The function
+     * @return False if the table is full
+     */
+    bool addSource(Source source);
+
+    /**
+     * @brief Run the sources
+     */
+    void poll();
+
+    /**
+     * @brief Handle the queued events
+     * @return Number of dispatched events
+     *
+     * The events posted by the handlers are dispatched at the next call.
+     */
+    uint16_t dispatch();
+
+    /**
+     * @brief Check for queued events
+     * @return True if events wait
+     */
+    [[nodiscard]] bool pending() const { return !queue.empty(); }
+
+    /**
+     * @brief Take the wake up request of the posts (see time::sleep)
+     * @return True if an event was posted since the last call
+     */
+    bool takeWakeUp();
+
+    /**
+     * @brief Number of events lost because of a full queue
+     * @return Dropped events
+     */
+    [[nodiscard]] uint32_t getDropped() const { return dropped; }
+
+    /**
+     * @brief Number of dispatched events of a type
+     * @param type The type
+     * @return The count
+     */
+    [[nodiscard]] uint32_t getCount(EventType type) const { return type < maxTypes ? types[type].count : 0; }
+
+    /**
+     * @brief Longest latency of a type
+     * @param type The type
+     * @return Latency in microseconds
+     */
+    [[nodiscard]] uint32_t getMaxLatency(EventType type) const { return type < maxTypes ? types[type].maxLatency : 0; }
+
+    /**
+     * @brief Mean latency of a type
+     * @param type The type
+     * @return Latency in microseconds (0 if no event)
+     */
+    [[nodiscard]] uint32_t getMeanLatency(EventType type) const;
+
+    /**
+     * @brief Clear the latency statistics
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief Handler and statistics of an event type
+     */
+    struct TypeData {
+        Handler handler     = nullptr;///< Handler of the type
+        void* context       = nullptr;///< Argument of the handler
+        uint32_t count      = 0;      ///< Dispatched events
+        uint32_t maxLatency = 0;      ///< Longest latency
+        uint64_t latency    = 0;      ///< Total latency
+    };
+    /// The event types
+    TypeData types[maxTypes];
+    /// The sources
+    Source sources[maxSources] = {};
+    /// The queued events
+    EventQueue queue;
+#ifdef NATIVE
+    /// Events lost
+    std::atomic<uint32_t> dropped{0};
+    /// If an event was posted since the last takeWakeUp
+    std::atomic<bool> wakeRequested{false};
+#else
+    /// Events lost
+    volatile uint32_t dropped = 0;
+    /// If an event was posted since the last takeWakeUp
+    volatile bool wakeRequested = false;
+#endif
+};
+
+/**
+ * @brief Access to the event loop of the main loop
+ * @return The main event loop
+ */
+EventLoop& events();
+
+}// namespace sbs
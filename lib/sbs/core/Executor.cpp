@@ -0,0 +1,139 @@
+/**
+ * @file Executor.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Executor.h"
+#ifdef NATIVE
+
+namespace sbs {
+
+/// Executor of the calling worker thread
+static thread_local const Executor* workerPool = nullptr;
+/// Queue of the calling worker thread
+static thread_local size_t workerIndex = 0;
+
+/**
+ * @brief A range handled by parallelFor
+ */
+struct RangeJob {
+    const Executor::RangeBody& body;///< Function handling a part
+    size_t grain;                   ///< Largest part
+    std::atomic<size_t> remaining;  ///< Indexes not handled yet
+};
+
+/**
+ * @brief Handle a part of a range: queue its upper halves down to the grain, then run the rest
+ * @param pool The executor
+ * @param job The range
+ * @param first First index of the part
+ * @param last Index after the part
+ */
+static void runRange(Executor& pool, RangeJob& job, size_t first, size_t last) {
+    while (last - first > job.grain) {
+        const size_t middle = first + (last - first) / 2;
+        pool.submit([&pool, &job, middle, last]() { runRange(pool, job, middle, last); });
+        last = middle;
+    }
+    job.body(first, last);
+    // the job may end at once: no access after this line
+    job.remaining -= last - first;
+}
+
+Executor::Executor(uint32_t threads_) {
+    if (threads_ == 0) threads_ = std::thread::hardware_concurrency();
+    if (threads_ == 0) threads_ = 1;
+    for (uint32_t index = 0; index < threads_; ++index)
+        workers.emplace_back(new Worker);
+    for (uint32_t index = 0; index < threads_; ++index)
+        threads.emplace_back(&Executor::work, this, index);
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock{sleepMutex};
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void Executor::submit(Task task) {
+    size_t index = selfIndex();
+    if (index == workers.size()) index = nextQueue++ % workers.size();
+    ++queued;
+    {
+        std::lock_guard<std::mutex> lock{workers[index]->mutex};
+        workers[index]->tasks.push_back(std::move(task));
+    }
+    // an empty critical section: a worker checking the count before sleeping gets the notification
+    { std::lock_guard<std::mutex> lock{sleepMutex}; }
+    wakeUp.notify_one();
+}
+
+void Executor::parallelFor(size_t begin, size_t end, size_t grain, const RangeBody& body) {
+    if (begin >= end) return;
+    RangeJob job{body, grain != 0 ? grain : 1, {end - begin}};
+    runRange(*this, job, begin, end);
+    // help until the stolen parts are done
+    const size_t self = selfIndex();
+    while (job.remaining != 0) {
+        if (!runOne(self)) std::this_thread::yield();
+    }
+}
+
+bool Executor::runOne(size_t self) {
+    const size_t count = workers.size();
+    Task task;
+    if (self < count) {
+        Worker& own = *workers[self];
+        const std::lock_guard<std::mutex> lock{own.mutex};
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (size_t offset = 1; offset <= count && !task; ++offset) {
+        const size_t index = (self + offset) % count;
+        if (index == self) continue;
+        Worker& victim = *workers[index];
+        const std::lock_guard<std::mutex> lock{victim.mutex};
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            if (self < count) ++stolen;
+        }
+    }
+    if (!task) return false;
+    --queued;
+    task();
+    return true;
+}
+
+void Executor::work(size_t index) {
+    workerPool  = this;
+    workerIndex = index;
+    for (;;) {
+        if (runOne(index)) continue;
+        std::unique_lock<std::mutex> lock{sleepMutex};
+        wakeUp.wait(lock, [this]() { return queued != 0 || stopping; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+size_t Executor::selfIndex() const {
+    return workerPool == this ? workerIndex : workers.size();
+}
+
+Executor& executor() {
+    static Executor instance;
+    return instance;
+}
+
+}// namespace sbs
+
+#endif
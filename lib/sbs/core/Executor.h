@@ -0,0 +1,172 @@
+/**
+ * @file Executor.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stddef.h>
+#include <stdint.h>
+#else
+#include <cstddef>
+#include <cstdint>
+#endif
+#ifdef NATIVE
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+/// Number of samples handled by one task of the batch functions
+#ifndef SBS_BATCH_GRAIN
+#define SBS_BATCH_GRAIN 4096
+#endif
+
+namespace sbs {
+
+#ifdef NATIVE
+
+/**
+ * @brief Work-stealing thread pool (native only)
+ *
+ * Each worker has its own queue of tasks: it takes the newest task of its queue (the
+ * data still in its cache), and when the queue is empty it steals the oldest task of the
+ * other queues (the biggest pieces of the split ranges). The workers sleep when no task
+ * is queued.
+ *
+ * parallelFor splits a range in halves down to the grain, the splits being queued where
+ * the other workers can steal them. The calling thread runs tasks until the range is
+ * done, so a parallelFor may be called from a task.
+ */
+class Executor {
+public:
+    /// A task
+    using Task = std::function<void()>;
+    /// Function handling a part of a range: [first, last)
+    using RangeBody = std::function<void(size_t first, size_t last)>;
+
+    /**
+     * @brief Constructor
+     * @param threads_ Number of workers (0 for one per hardware thread)
+     */
+    explicit Executor(uint32_t threads_ = 0);
+    Executor(const Executor&)            = delete;
+    Executor(Executor&&)                 = delete;
+    Executor& operator=(const Executor&) = delete;
+    Executor& operator=(Executor&&)      = delete;
+    /**
+     * @brief Destructor: runs the queued tasks, then stops the workers
+     */
+    ~Executor();
+
+    /**
+     * @brief Queue a task
+     * @param task The task
+     *
+     * From a worker, the task goes to the worker's own queue, else the queues are used in turn.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Handle a range in parallel
+     * @param begin First index
+     * @param end Index after the last one
+     * @param grain Largest part given to the body at once (0 for 1)
+     * @param body Function handling a part
+     *
+     * Returns when the whole range is done.
+     */
+    void parallelFor(size_t begin, size_t end, size_t grain, const RangeBody& body);
+
+    /**
+     * @brief Number of workers
+     * @return The worker count
+     */
+    [[nodiscard]] uint32_t getThreadCount() const { return static_cast<uint32_t>(workers.size()); }
+
+    /**
+     * @brief Number of tasks a worker took from the queue of another one
+     * @return Stolen tasks
+     */
+    [[nodiscard]] uint64_t getStolen() const { return stolen; }
+
+private:
+    /**
+     * @brief Queue of a worker
+     */
+    struct Worker {
+        std::mutex mutex;      ///< Protection of the queue
+        std::deque<Task> tasks;///< Queued tasks, the newest at the back
+    };
+    /// Queues of the workers
+    std::vector<std::unique_ptr<Worker>> workers;
+    /// The worker threads
+    std::vector<std::thread> threads;
+    /// Number of queued tasks
+    std::atomic<uint32_t> queued{0};
+    /// Next queue for the tasks submitted from outside
+    std::atomic<uint32_t> nextQueue{0};
+    /// Tasks taken from another queue
+    std::atomic<uint64_t> stolen{0};
+    /// If the workers should stop
+    std::atomic<bool> stopping{false};
+    /// Protection of the sleep of the workers
+    std::mutex sleepMutex;
+    /// Wakes the sleeping workers
+    std::condition_variable wakeUp;
+
+    /**
+     * @brief Take a task and run it
+     * @param self Queue of the calling worker (workers.size() for another thread)
+     * @return False if no task was queued
+     */
+    bool runOne(size_t self);
+
+    /**
+     * @brief Loop of a worker thread
+     * @param index The worker
+     */
+    void work(size_t index);
+
+    /**
+     * @brief Queue of the calling thread in this executor
+     * @return The queue index, or workers.size() for a thread of another pool
+     */
+    [[nodiscard]] size_t selfIndex() const;
+};
+
+/**
+ * @brief Access to the executor shared by the process (one worker per hardware thread)
+ * @return The executor
+ */
+Executor& executor();
+
+#endif
+
+/**
+ * @brief Handle a range in parallel on the shared executor (in one part on the boards)
+ * @tparam Body Function type: `void(size_t first, size_t last)`
+ * @param begin First index
+ * @param end Index after the last one
+ * @param grain Largest part given to the body at once
+ * @param body Function handling a part of the range
+ */
+template<class Body>
+void parallelFor(size_t begin, size_t end, size_t grain, const Body& body) {
+#ifdef NATIVE
+    executor().parallelFor(begin, end, grain, body);
+#else
+    (void) grain;
+    if (begin < end) body(begin, end);
+#endif
+}
+
+}// namespace sbs
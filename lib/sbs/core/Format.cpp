@@ -0,0 +1,296 @@
+/**
+ * @file Format.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Format.h"
+#include "math/functions.h"
+#include <string.h>
+#ifdef ARDUINO_ARCH_AVR
+#include <avr/pgmspace.h>
+/// Constant tables stay in flash on AVR
+#define SBS_FORMAT_TABLE PROGMEM
+#else
+#define SBS_FORMAT_TABLE
+#endif
+
+namespace sbs::io::format {
+
+/// List of hexadecimal digits
+static const char hexDigits[] SBS_FORMAT_TABLE = "0123456789ABCDEF";
+
+/// Binary digits of each nibble
+static const char nibbleBits[16][4] SBS_FORMAT_TABLE = {
+        {'0', '0', '0', '0'},
+        {'0', '0', '0', '1'},
+        {'0', '0', '1', '0'},
+        {'0', '0', '1', '1'},
+        {'0', '1', '0', '0'},
+        {'0', '1', '0', '1'},
+        {'0', '1', '1', '0'},
+        {'0', '1', '1', '1'},
+        {'1', '0', '0', '0'},
+        {'1', '0', '0', '1'},
+        {'1', '0', '1', '0'},
+        {'1', '0', '1', '1'},
+        {'1', '1', '0', '0'},
+        {'1', '1', '0', '1'},
+        {'1', '1', '1', '0'},
+        {'1', '1', '1', '1'},
+};
+
+/// All the pairs of decimal digits: "00", "01", ..., "99"
+static const char digitPairs[201] SBS_FORMAT_TABLE =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+/// Powers of ten that fit in 64 bits
+static const uint64_t powers10[] SBS_FORMAT_TABLE = {
+        1ULL,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL,
+        10000000000ULL,
+        100000000000ULL,
+        1000000000000ULL,
+        10000000000000ULL,
+        100000000000000ULL,
+        1000000000000000ULL,
+        10000000000000000ULL,
+        100000000000000000ULL,
+        1000000000000000000ULL,
+};
+
+#ifdef ARDUINO_ARCH_AVR
+/**
+ * @brief Read a character of a table
+ * @param table The table
+ * @param index The character index
+ * @return The character
+ */
+static char tableChar(const char* table, uint32_t index) {
+    return static_cast<char>(pgm_read_byte(table + index));
+}
+
+/**
+ * @brief Get a power of ten
+ * @param exponent The exponent
+ * @return 10^exponent
+ */
+static uint64_t power10(uint8_t exponent) {
+    uint64_t result;
+    memcpy_P(&result, powers10 + exponent, sizeof(uint64_t));
+    return result;
+}
+
+/**
+ * @brief Copy the binary digits of a nibble
+ * @param buffer Output buffer
+ * @param nibble The nibble
+ */
+static void copyNibble(char* buffer, uint8_t nibble) {
+    memcpy_P(buffer, nibbleBits[nibble], 4);
+}
+#else
+/**
+ * @brief Read a character of a table
+ * @param table The table
+ * @param index The character index
+ * @return The character
+ */
+static char tableChar(const char* table, uint32_t index) {
+    return table[index];
+}
+
+/**
+ * @brief Get a power of ten
+ * @param exponent The exponent
+ * @return 10^exponent
+ */
+static uint64_t power10(uint8_t exponent) {
+    return powers10[exponent];
+}
+
+/**
+ * @brief Copy the binary digits of a nibble
+ * @param buffer Output buffer
+ * @param nibble The nibble
+ */
+static void copyNibble(char* buffer, uint8_t nibble) {
+    memcpy(buffer, nibbleBits[nibble], 4);
+}
+#endif
+
+/// Number of decimals computed exactly (more are padded with zeros)
+constexpr uint8_t exactDecimals = 18;
+
+/**
+ * @brief Number of decimal digits of a 32 bits integer
+ * @param value The integer
+ * @return The digit count
+ */
+static uint8_t digitCount(uint32_t value) {
+    uint8_t count = 1;
+    while (count < 10 && value >= power10(count)) ++count;
+    return count;
+}
+
+/**
+ * @brief Write the digits of a 32 bits integer, two by two from the end
+ * @param end One past the last character
+ * @param value The integer
+ */
+static void writeDigits(char* end, uint32_t value) {
+    while (value >= 100) {
+        const uint32_t pair = (value % 100) * 2;
+        value /= 100;
+        *--end = tableChar(digitPairs, pair + 1);
+        *--end = tableChar(digitPairs, pair);
+    }
+    if (value >= 10) {
+        *--end = tableChar(digitPairs, value * 2 + 1);
+        *--end = tableChar(digitPairs, value * 2);
+    } else {
+        *--end = static_cast<char>('0' + value);
+    }
+}
+
+/**
+ * @brief Write a fixed number of digits (with leading zeros)
+ * @param buffer Output buffer
+ * @param value The integer (lower than 10^count)
+ * @param count Number of digits (9 at most)
+ */
+static void writeFixedDigits(char* buffer, uint32_t value, uint8_t count) {
+    char* end = buffer + count;
+    while (end - buffer >= 2) {
+        const uint32_t pair = (value % 100) * 2;
+        value /= 100;
+        *--end = tableChar(digitPairs, pair + 1);
+        *--end = tableChar(digitPairs, pair);
+    }
+    if (end != buffer)
+        *--end = static_cast<char>('0' + value);
+}
+
+uint8_t toDecimal(char* buffer, uint64_t value) {
+    // 32 bits fast path: no 64 bits division
+    if (value <= 0xFFFFFFFFULL) {
+        const auto small    = static_cast<uint32_t>(value);
+        const uint8_t count = digitCount(small);
+        writeDigits(buffer + count, small);
+        return count;
+    }
+    // split into 9-digit blocks, so that only the top block needs a digit count
+    constexpr uint32_t blockBase = 1000000000UL;
+    uint32_t blocks[3];
+    uint8_t blockCount = 0;
+    while (value >= blockBase) {
+        blocks[blockCount++] = static_cast<uint32_t>(value % blockBase);
+        value /= blockBase;
+    }
+    uint8_t count = toDecimal(buffer, value);
+    while (blockCount > 0) {
+        writeFixedDigits(buffer + count, blocks[--blockCount], 9);
+        count += 9;
+    }
+    return count;
+}
+
+uint8_t toDecimal(char* buffer, int64_t value) {
+    if (value >= 0)
+        return toDecimal(buffer, static_cast<uint64_t>(value));
+    buffer[0] = '-';
+    return 1 + toDecimal(buffer + 1, static_cast<uint64_t>(0) - static_cast<uint64_t>(value));
+}
+
+uint8_t toHexadecimal(char* buffer, uint64_t value, uint8_t size) {
+    const uint8_t count = 2 * size;
+    for (uint8_t i = count; i > 0; --i) {
+        buffer[i - 1] = tableChar(hexDigits, value & 0xF);
+        value >>= 4;
+    }
+    return count;
+}
+
+uint8_t toBinary(char* buffer, uint64_t value, uint8_t size) {
+    const uint8_t count = 8 * size;
+    for (uint8_t i = count; i > 0; i -= 4) {
+        copyNibble(buffer + i - 4, value & 0xF);
+        value >>= 4;
+    }
+    return count;
+}
+
+uint8_t toFixed(char* buffer, double value, uint8_t digit) {
+    if (math::isnan(value)) {
+        memcpy(buffer, "nan", 3);
+        return 3;
+    }
+    if (math::isinf(value)) {
+        memcpy(buffer, "inf", 3);
+        return 3;
+    }
+    if (value > 4294967040.0 || value < -4294967040.0) {
+        memcpy(buffer, "ovf", 3);// constant determined empirically
+        return 3;
+    }
+    uint8_t count = 0;
+    if (value < 0.0) {
+        buffer[count++] = '-';
+        value           = -value;
+    }
+    // keep the output bounded
+    if (digit > maxFormatSize - 12)
+        digit = maxFormatSize - 12;
+    const uint8_t exact = digit < exactDecimals ? digit : exactDecimals;
+    // fixed point: integer part and rounded fractional part scaled by 10^exact
+    auto intPart        = static_cast<uint32_t>(value);
+    const uint64_t unit = power10(exact);
+    const double scaled = (value - static_cast<double>(intPart)) * static_cast<double>(unit) + 0.5;
+    auto fraction       = static_cast<uint64_t>(scaled);
+    if (fraction >= unit) {
+        fraction -= unit;
+        if (intPart == 0xFFFFFFFFUL) {
+            memcpy(buffer, "ovf", 3);
+            return 3;
+        }
+        ++intPart;
+    }
+    const uint8_t intSize = digitCount(intPart);
+    writeDigits(buffer + count + intSize, intPart);
+    count += intSize;
+    if (digit == 0)
+        return count;
+    buffer[count++] = '.';
+    // decimals with their leading zeros, then the padding
+    char* decimals = buffer + count;
+    if (exact <= 9) {
+        writeFixedDigits(decimals, static_cast<uint32_t>(fraction), exact);
+    } else {
+        writeFixedDigits(decimals, static_cast<uint32_t>(fraction / 1000000000UL), exact - 9);
+        writeFixedDigits(decimals + exact - 9, static_cast<uint32_t>(fraction % 1000000000UL), 9);
+    }
+    if (digit > exact)
+        memset(decimals + exact, '0', digit - exact);
+    return count + digit;
+}
+
+}// namespace sbs::io::format
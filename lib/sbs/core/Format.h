@@ -0,0 +1,72 @@
+/**
+ * @file Format.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+/**
+ * @brief Conversion of numbers to text into caller buffers
+ *
+ * None of the functions adds a terminating null character; they return the number of
+ * characters written. The buffer must hold at least maxFormatSize characters.
+ */
+namespace sbs::io::format {
+
+/// Size of the longest formatted number (64 binary digits and sign)
+constexpr uint8_t maxFormatSize = 66;
+
+/**
+ * @brief Format an unsigned integer in decimal
+ * @param buffer Output buffer
+ * @param value The integer
+ * @return Number of characters
+ */
+uint8_t toDecimal(char* buffer, uint64_t value);
+
+/**
+ * @brief Format a signed integer in decimal
+ * @param buffer Output buffer
+ * @param value The integer
+ * @return Number of characters
+ */
+uint8_t toDecimal(char* buffer, int64_t value);
+
+/**
+ * @brief Format an integer in hexadecimal, with all its digits
+ * @param buffer Output buffer
+ * @param value The integer
+ * @param size Size of the integer type in bytes
+ * @return Number of characters
+ */
+uint8_t toHexadecimal(char* buffer, uint64_t value, uint8_t size);
+
+/**
+ * @brief Format an integer in binary, with all its digits
+ * @param buffer Output buffer
+ * @param value The integer
+ * @param size Size of the integer type in bytes
+ * @return Number of characters
+ */
+uint8_t toBinary(char* buffer, uint64_t value, uint8_t size);
+
+/**
+ * @brief Format a floating point number with a fixed number of decimals
+ * @param buffer Output buffer
+ * @param value The number
+ * @param digit Number of decimals
+ * @return Number of characters
+ *
+ * Gives `nan`, `inf`, or `ovf` when the integer part does not fit in 32 bits.
+ */
+uint8_t toFixed(char* buffer, double value, uint8_t digit);
+
+}// namespace sbs::io::format
@@ -0,0 +1,39 @@
+/**
+ * @file LogLimiter.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "LogLimiter.h"
+#include "time/timing.h"
+
+namespace sbs::io {
+
+bool LogLimiter::accept(uint32_t digest, const Verbosity& level) {
+    const uint32_t now = time::millis();
+    const bool same    = started && digest == lastDigest;
+    if (started && (interval == 0 ? same : now - lastTime < interval)) {
+        uint16_t& counter = same ? repeated : suppressed;
+        if (counter != 0xFFFF) ++counter;
+        return false;
+    }
+    flush(level);
+    started    = true;
+    lastDigest = digest;
+    lastTime   = now;
+    return true;
+}
+
+void LogLimiter::flush(const Verbosity& level) {
+    if (suppressed != 0) {
+        io::log(level, static_cast<uint32_t>(repeated) + suppressed, " messages suppressed");
+    } else if (repeated != 0) {
+        io::log(level, "last message repeated ", repeated, " times");
+    }
+    repeated   = 0;
+    suppressed = 0;
+}
+
+}// namespace sbs::io
@@ -0,0 +1,96 @@
+/**
+ * @file LogLimiter.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "LogLine.h"
+#include "Node.h"
+
+/**
+ * @brief Print a line from a call site that may flood the log
+ *
+ * The call site prints at most one line per interval (in milliseconds); identical lines
+ * are folded into a `last message repeated N times` line, printed before the next one.
+ * With an interval of 0, only consecutive identical lines are folded.
+ */
+#define SBS_LOG_LIMITED(interval, level, ...)                              \
+    do {                                                                   \
+        static ::sbs::NodeLocal<::sbs::io::LogLimiter> sbsLogLimiter{      \
+                ::sbs::io::LogLimiter{interval}};                          \
+        sbsLogLimiter->log(level, __VA_ARGS__);                            \
+    } while (0)
+
+namespace sbs::io {
+
+/**
+ * @brief Rate limiting and deduplication state of a log call site
+ */
+class LogLimiter {
+public:
+    /**
+     * @brief Constructor
+     * @param interval_ Minimal time between two lines in milliseconds (0: deduplication only)
+     */
+    constexpr explicit LogLimiter(uint32_t interval_) :
+        interval{interval_} {}
+
+    /**
+     * @brief Print a line, unless limited
+     * @tparam Args Types of the arguments
+     * @param level The message's level
+     * @param args The line content (see io::log)
+     */
+    template<class... Args>
+    void log(const Verbosity& level, const Args&... args) {
+        if (static_cast<int>(level) > SBS_LOG_LEVEL || !isLogged(level)) return;
+        LogLine line;
+        appendAll(line, args...);
+        if (accept(line.digest(), level))
+            line.send(level);
+    }
+
+    /**
+     * @brief Print the summary of the suppressed lines, if any
+     * @param level The summary's level
+     */
+    void flush(const Verbosity& level);
+
+    /**
+     * @brief Number of lines folded since the last printed one
+     * @return Repeated lines
+     */
+    [[nodiscard]] uint16_t getRepeated() const { return repeated; }
+
+    /**
+     * @brief Number of different lines suppressed since the last printed one
+     * @return Suppressed lines
+     */
+    [[nodiscard]] uint16_t getSuppressed() const { return suppressed; }
+
+private:
+    /// Minimal time between two lines
+    uint32_t interval;
+    /// Time of the last printed line
+    uint32_t lastTime = 0;
+    /// Digest of the last printed line
+    uint32_t lastDigest = 0;
+    /// Identical lines suppressed
+    uint16_t repeated = 0;
+    /// Other lines suppressed
+    uint16_t suppressed = 0;
+    /// If a line has been printed
+    bool started = false;
+    /**
+     * @brief Decide if a line is printed
+     * @param digest The line's digest
+     * @param level The line's level
+     * @return True if the line must be printed
+     */
+    bool accept(uint32_t digest, const Verbosity& level);
+};
+
+}// namespace sbs::io
@@ -0,0 +1,68 @@
+/**
+ * @file LogLine.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "LogLine.h"
+
+namespace sbs::io {
+
+void LogLine::appendRaw(const char* str, uint16_t size) {
+    // keep room for the ellipsis
+    constexpr uint16_t capacity = SBS_LOG_LINE_SIZE - 3;
+    if (overflow) return;
+    if (length + size > capacity) {
+        size     = capacity - length;
+        overflow = true;
+    }
+    for (uint16_t i = 0; i < size; ++i)
+        buffer[length++] = str[i];
+}
+
+void LogLine::append(const char* str) {
+    uint16_t size = 0;
+    while (str[size] != '\0') ++size;
+    appendRaw(str, size);
+}
+
+void LogLine::append(const FixedDouble& value) {
+    char text[format::maxFormatSize];
+    appendRaw(text, format::toFixed(text, value.value, value.digit));
+}
+
+void LogLine::append(const FormattedInt& value) {
+    char text[format::maxFormatSize];
+    switch (value.format) {
+        case IntFormat::Hexadecimal:
+            appendRaw(text, format::toHexadecimal(text, value.value, value.size));
+            break;
+        case IntFormat::Binary:
+            appendRaw(text, format::toBinary(text, value.value, value.size));
+            break;
+        default:
+            appendRaw(text, format::toDecimal(text, value.value));
+            break;
+    }
+}
+
+uint32_t LogLine::digest() const {
+    uint32_t hash = 2166136261UL;
+    for (uint16_t i = 0; i < length; ++i)
+        hash = (hash ^ static_cast<uint8_t>(buffer[i])) * 16777619UL;
+    return hash;
+}
+
+void LogLine::send(const Verbosity& level) {
+    if (overflow) {
+        for (uint8_t i = 0; i < 3; ++i)
+            buffer[length++] = '.';
+    }
+    printLine(buffer, length, level);
+    length   = 0;
+    overflow = false;
+}
+
+}// namespace sbs::io
@@ -0,0 +1,229 @@
+/**
+ * @file LogLine.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "Format.h"
+#include "LogSink.h"
+#include "Print.h"
+
+namespace sbs::io {
+
+/**
+ * @brief Integer with a forced format
+ */
+struct FormattedInt {
+    uint64_t value;  ///< The raw value
+    uint8_t size;    ///< Size of the integer type in bytes
+    IntFormat format;///< The format
+};
+
+/**
+ * @brief Floating point value with a number of decimals
+ */
+struct FixedDouble {
+    double value;///< The value
+    uint8_t digit;///< Number of decimals
+};
+
+/**
+ * @brief Named value, printed as `key=value`
+ * @tparam T Type of the value
+ */
+template<class T>
+struct Field {
+    const char* key;///< The name
+    T value;        ///< The value
+};
+
+/**
+ * @brief Print an integer in hexadecimal
+ * @tparam T The integer type
+ * @param value The integer
+ * @return The formatted integer
+ */
+template<class T>
+FormattedInt hex(T value) { return {static_cast<uint64_t>(value), sizeof(T), IntFormat::Hexadecimal}; }
+
+/**
+ * @brief Print an integer in binary
+ * @tparam T The integer type
+ * @param value The integer
+ * @return The formatted integer
+ */
+template<class T>
+FormattedInt bin(T value) { return {static_cast<uint64_t>(value), sizeof(T), IntFormat::Binary}; }
+
+/**
+ * @brief Print a floating point value with the given decimals
+ * @param value The value
+ * @param digit Number of decimals
+ * @return The formatted value
+ */
+inline FixedDouble fixed(double value, uint8_t digit) { return {value, digit}; }
+
+/**
+ * @brief Define a structured field
+ * @tparam T Type of the value
+ * @param key The name
+ * @param value The value
+ * @return The field
+ */
+template<class T>
+Field<T> field(const char* key, const T& value) { return {key, value}; }
+
+/**
+ * @brief Line assembly buffer
+ *
+ * Text beyond the buffer capacity is cut and the line ends with `...`.
+ */
+class LogLine {
+public:
+    /**
+     * @brief Append a string
+     * @param str The string
+     */
+    void append(const char* str);
+
+    /**
+     * @brief Append a string
+     * @param str The string
+     */
+    void append(char* str) { append(static_cast<const char*>(str)); }
+
+    /**
+     * @brief Append a string
+     * @param str The string
+     */
+    void append(const string& str) { append(str.c_str()); }
+
+    /**
+     * @brief Append a character
+     * @param c The character
+     */
+    void append(char c) { appendRaw(&c, 1); }
+
+    /**
+     * @brief Append a boolean
+     * @param value The boolean
+     */
+    void append(bool value) { append(value ? "true" : "false"); }
+
+    /**
+     * @brief Append a floating point value with 2 decimals
+     * @param value The value
+     */
+    void append(double value) { append(FixedDouble{value, 2}); }
+
+    /**
+     * @brief Append a floating point value with 2 decimals
+     * @param value The value
+     */
+    void append(float value) { append(FixedDouble{static_cast<double>(value), 2}); }
+
+    /**
+     * @brief Append a floating point value
+     * @param value The value
+     */
+    void append(const FixedDouble& value);
+
+    /**
+     * @brief Append an integer with a forced format
+     * @param value The integer
+     */
+    void append(const FormattedInt& value);
+
+    /**
+     * @brief Append an integer in decimal
+     * @tparam T The integer type
+     * @param value The integer
+     */
+    template<class T>
+    void append(T value) {
+        char text[format::maxFormatSize];
+        if (static_cast<T>(-1) < static_cast<T>(0))
+            appendRaw(text, format::toDecimal(text, static_cast<int64_t>(value)));
+        else
+            appendRaw(text, format::toDecimal(text, static_cast<uint64_t>(value)));
+    }
+
+    /**
+     * @brief Append a field, separated from the previous text by a space
+     * @tparam T Type of the value
+     * @param value The field
+     */
+    template<class T>
+    void append(const Field<T>& value) {
+        if (length != 0) append(' ');
+        append(value.key);
+        append('=');
+        append(value.value);
+    }
+
+    /**
+     * @brief Compute a digest of the line content
+     * @return The digest (32 bits FNV-1a)
+     */
+    [[nodiscard]] uint32_t digest() const;
+
+    /**
+     * @brief Send the line to the log
+     * @param level The message's level
+     */
+    void send(const Verbosity& level);
+
+private:
+    /// Line content
+    char buffer[SBS_LOG_LINE_SIZE];
+    /// Line length
+    uint16_t length = 0;
+    /// If text has been cut
+    bool overflow = false;
+    /**
+     * @brief Append characters
+     * @param str The characters
+     * @param size Number of characters
+     */
+    void appendRaw(const char* str, uint16_t size);
+};
+
+/**
+ * @brief Stop argument recursion
+ */
+inline void appendAll(LogLine&) {}
+
+/**
+ * @brief Append the arguments to a line
+ * @tparam First Type of the first argument
+ * @tparam Rest Types of the other arguments
+ * @param line The line
+ * @param first The first argument
+ * @param rest The other arguments
+ */
+template<class First, class... Rest>
+void appendAll(LogLine& line, const First& first, const Rest&... rest) {
+    line.append(first);
+    appendAll(line, rest...);
+}
+
+/**
+ * @brief Print a whole line in one call
+ * @tparam Args Types of the arguments
+ * @param level The message's level (Mute for log messages)
+ * @param args The line content: strings, characters, booleans, numbers, hex(), bin(), fixed(), field()
+ *
+ * The line is assembled in one pass and printed with a single prefix and a return line.
+ */
+template<class... Args>
+void log(const Verbosity& level, const Args&... args) {
+    if (static_cast<int>(level) > SBS_LOG_LEVEL || !isLogged(level)) return;
+    LogLine line;
+    appendAll(line, args...);
+    line.send(level);
+}
+
+}// namespace sbs::io
@@ -0,0 +1,247 @@
+/**
+ * @file LogSink.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "LogSink.h"
+#include "Node.h"
+#ifdef NATIVE
+#include <iostream>
+#else
+#include <Arduino.h>
+#endif
+
+namespace sbs::io {
+
+// ----------------- BUFFERED SINK ------------------------
+
+void BufferedSink::reportDropped() {
+    if (unreported == 0) return;
+    char marker[24] = "[dropped ";
+    uint8_t pos     = 9;
+    char digits[10];
+    uint8_t count = 0;
+    uint32_t n    = unreported;
+    do {
+        digits[count++] = static_cast<char>('0' + n % 10);
+        n /= 10;
+    } while (n != 0);
+    while (count > 0)
+        marker[pos++] = digits[--count];
+    marker[pos++] = ']';
+    marker[pos++] = '\n';
+    if (ring.push(reinterpret_cast<const uint8_t*>(marker), pos))
+        unreported = 0;
+}
+
+void BufferedSink::write(const uint8_t* data, uint16_t size) {
+    if (mode == LogMode::Direct) {
+        deviceWrite(data, size);
+        return;
+    }
+    reportDropped();
+    if (unreported != 0 || !ring.push(data, size)) {
+        ++unreported;
+        ++dropped;
+    }
+    update();
+}
+
+void BufferedSink::update() {
+    if (held) return;
+    while (!ring.empty()) {
+        uint16_t length;
+        const uint8_t* chunk = ring.peek(length);
+        length               = deviceRoom(length);
+        if (length == 0) return;
+        deviceWrite(chunk, length);
+        ring.pop(length);
+    }
+}
+
+void BufferedSink::flush() {
+    // the drop marker may only fit once the ring is empty
+    for (uint8_t pass = 0; pass < 2; ++pass) {
+        uint16_t length;
+        const uint8_t* chunk = ring.peek(length);
+        while (length != 0) {
+            deviceWrite(chunk, length);
+            ring.pop(length);
+            chunk = ring.peek(length);
+        }
+        reportDropped();
+    }
+}
+
+void BufferedSink::setMode(const LogMode& mode_) {
+    flush();
+    mode = mode_;
+}
+
+void BufferedSink::setHold(bool hold) {
+    held = hold;
+    if (!held) update();
+}
+
+// ----------------- SERIAL SINK ------------------------
+
+uint16_t SerialSink::deviceRoom(uint16_t wanted) {
+#ifdef NATIVE
+    return wanted;
+#else
+    int room = Serial.availableForWrite();
+    if (room <= 0) return 0;
+    return static_cast<uint16_t>(room) < wanted ? static_cast<uint16_t>(room) : wanted;
+#endif
+}
+
+void SerialSink::deviceWrite(const uint8_t* data, uint16_t size) {
+#ifdef NATIVE
+    std::cout.write(reinterpret_cast<const char*>(data), size);
+#else
+    Serial.write(data, size);
+#endif
+}
+
+// ----------------- ROUTING ------------------------
+
+/**
+ * @brief State of the log routing
+ */
+struct Routing {
+    SerialSink serial;                     ///< The serial sink
+    Sink* sinks[SBS_LOG_SINKS] = {&serial};///< Registered sinks
+    LogMode logMode = LogMode::Buffered;   ///< Current output mode
+    char line[SBS_LOG_LINE_SIZE]{};        ///< Line being assembled
+    uint16_t lineLength = 0;               ///< Length of the line being assembled
+    Verbosity lineLevel = Verbosity::Mute; ///< Level of the line being assembled
+};
+/// The log routing of each node
+static NodeLocal<Routing> routing;
+
+/**
+ * @brief Give output to every sink accepting its level
+ * @param data The output
+ * @param length Output size
+ * @param level The output's level
+ */
+static void dispatch(const uint8_t* data, uint16_t length, const Verbosity& level) {
+    for (Sink* sink : routing->sinks) {
+        if (sink != nullptr && sink->accepts(level))
+            sink->write(data, length);
+    }
+}
+
+/**
+ * @brief Give the assembled line to the sinks
+ */
+static void commitLine() {
+    if (routing->lineLength == 0) return;
+    dispatch(reinterpret_cast<const uint8_t*>(routing->line), routing->lineLength, routing->lineLevel);
+    routing->lineLength = 0;
+}
+
+SerialSink& serialSink() {
+    return routing->serial;
+}
+
+bool addSink(Sink& sink) {
+    Sink** freeSlot = nullptr;
+    for (Sink*& slot : routing->sinks) {
+        if (slot == &sink) return false;
+        if (slot == nullptr && freeSlot == nullptr) freeSlot = &slot;
+    }
+    if (freeSlot == nullptr) return false;
+    *freeSlot = &sink;
+    return true;
+}
+
+void removeSink(Sink& sink) {
+    for (Sink*& slot : routing->sinks) {
+        if (slot == &sink) {
+            commitLine();
+            sink.flush();
+            slot = nullptr;
+        }
+    }
+}
+
+void setLogMode(const LogMode& mode) {
+    flushLog();
+    routing->logMode = mode;
+    routing->serial.setMode(mode);
+}
+
+LogMode getLogMode() {
+    return routing->logMode;
+}
+
+void logLevel(const Verbosity& level) {
+    commitLine();
+    routing->lineLevel = level;
+}
+
+void logPut(char c) {
+    if (routing->logMode == LogMode::Direct) {
+        dispatch(reinterpret_cast<const uint8_t*>(&c), 1, routing->lineLevel);
+        return;
+    }
+    routing->line[routing->lineLength++] = c;
+    if (c == '\n' || routing->lineLength == SBS_LOG_LINE_SIZE)
+        commitLine();
+}
+
+void logWrite(const char* str, uint16_t length) {
+    if (routing->logMode == LogMode::Direct) {
+        dispatch(reinterpret_cast<const uint8_t*>(str), length, routing->lineLevel);
+        return;
+    }
+    for (uint16_t i = 0; i < length; ++i)
+        logPut(str[i]);
+}
+
+void logWrite(const char* str) {
+    if (routing->logMode == LogMode::Direct) {
+        uint16_t length = 0;
+        while (str[length] != '\0') ++length;
+        logWrite(str, length);
+        return;
+    }
+    while (*str != '\0')
+        logPut(*str++);
+}
+
+void logRecord(const uint8_t* data, uint16_t length, const Verbosity& level) {
+    commitLine();
+    dispatch(data, length, level);
+}
+
+void drainLog() {
+    for (Sink* sink : routing->sinks) {
+        if (sink != nullptr) sink->update();
+    }
+}
+
+void flushLog() {
+    commitLine();
+    for (Sink* sink : routing->sinks) {
+        if (sink != nullptr) sink->flush();
+    }
+}
+
+void setLogHold(bool hold) {
+    routing->serial.setHold(hold);
+}
+
+uint16_t getLogPending() {
+    return routing->serial.getPending();
+}
+
+uint32_t getLogDropped() {
+    return routing->serial.getDropped();
+}
+
+}// namespace sbs::io
@@ -0,0 +1,389 @@
+/**
+ * @file LogSink.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "Print.h"
+#include "RingBuffer.h"
+#ifdef NATIVE
+#include <string>
+#endif
+
+/// Size of the log ring buffer in bytes
+#ifndef SBS_LOG_BUFFER_SIZE
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_LOG_BUFFER_SIZE 128
+#else
+#define SBS_LOG_BUFFER_SIZE 1024
+#endif
+#endif
+/// Size of the line assembly buffer in bytes
+#ifndef SBS_LOG_LINE_SIZE
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_LOG_LINE_SIZE 48
+#else
+#define SBS_LOG_LINE_SIZE 128
+#endif
+#endif
+/// Maximum number of registered sinks
+#ifndef SBS_LOG_SINKS
+#define SBS_LOG_SINKS 4
+#endif
+
+namespace sbs::io {
+
+/**
+ * @brief Output mode of the log
+ */
+enum struct LogMode {
+    Direct,  ///< Every print is written to the device immediately (may block on the serial line)
+    Buffered,///< Lines are assembled in RAM and drained to the device without blocking
+};
+
+/**
+ * @brief Destination of the log
+ *
+ * The log output is formatted once, then each registered sink receives the same bytes:
+ * complete lines, pieces of a line (line longer than the assembly buffer, flush, direct
+ * mode) or binary records. A sink only receives the lines up to its level.
+ */
+class Sink {
+public:
+    Sink()                       = default;
+    Sink(const Sink&)            = delete;
+    Sink(Sink&&)                 = delete;
+    Sink& operator=(const Sink&) = delete;
+    Sink& operator=(Sink&&)      = delete;
+    virtual ~Sink()              = default;//---UNCOVER---
+
+    /**
+     * @brief Receive log output
+     * @param data The bytes
+     * @param size Number of bytes
+     */
+    virtual void write(const uint8_t* data, uint16_t size) = 0;
+
+    /**
+     * @brief Background work, called from the main loop (must not block)
+     */
+    virtual void update() {}
+
+    /**
+     * @brief Push everything to the destination (may block)
+     */
+    virtual void flush() {}
+
+    /**
+     * @brief Define the highest level received
+     * @param level_ The level
+     */
+    void setLevel(const Verbosity& level_) { level = level_; }
+
+    /**
+     * @brief Get the highest level received
+     * @return The level
+     */
+    [[nodiscard]] const Verbosity& getLevel() const { return level; }
+
+    /**
+     * @brief Check if a line is received
+     * @param lineLevel The line's level
+     * @return True if received
+     */
+    [[nodiscard]] bool accepts(const Verbosity& lineLevel) const {
+        return static_cast<uint8_t>(lineLevel) <= static_cast<uint8_t>(level);
+    }
+
+private:
+    /// Highest level received
+    Verbosity level = Verbosity::Debug;
+};
+
+/**
+ * @brief Sink writing to a slow device through a RAM ring buffer
+ *
+ * In buffered mode, the output is queued and drained without blocking: only the bytes the
+ * device can accept immediately are written. When the ring is full, new output is dropped
+ * and counted, and a `[dropped N]` marker is queued as soon as there is room again.
+ */
+class BufferedSink : public Sink {
+public:
+    void write(const uint8_t* data, uint16_t size) override;
+    void update() override;
+    void flush() override;
+
+    /**
+     * @brief Define the output mode
+     * @param mode_ The mode
+     */
+    void setMode(const LogMode& mode_);
+
+    /**
+     * @brief Get the output mode
+     * @return The mode
+     */
+    [[nodiscard]] const LogMode& getMode() const { return mode; }
+
+    /**
+     * @brief Hold the output: data stays in the buffer until released (flush still writes)
+     * @param hold If the output is held
+     */
+    void setHold(bool hold);
+
+    /**
+     * @brief Number of bytes waiting in the ring buffer
+     * @return Pending bytes
+     */
+    [[nodiscard]] uint16_t getPending() const { return ring.size(); }
+
+    /**
+     * @brief Number of pieces of output dropped because the buffer was full
+     * @return Dropped pieces since start
+     */
+    [[nodiscard]] uint32_t getDropped() const { return dropped; }
+
+protected:
+    /**
+     * @brief Number of bytes the device can take without blocking
+     * @param wanted Number of bytes to write
+     * @return Number of bytes to write now
+     */
+    virtual uint16_t deviceRoom(uint16_t wanted) = 0;
+
+    /**
+     * @brief Write bytes to the device
+     * @param data The bytes
+     * @param size Number of bytes
+     */
+    virtual void deviceWrite(const uint8_t* data, uint16_t size) = 0;
+
+private:
+    /// Queued output
+    RingBuffer<SBS_LOG_BUFFER_SIZE> ring;
+    /// Output mode
+    LogMode mode = LogMode::Buffered;
+    /// If draining is suspended
+    bool held = false;
+    /// Pieces dropped and not yet reported
+    uint32_t unreported = 0;
+    /// Pieces dropped since start
+    uint32_t dropped = 0;
+    /**
+     * @brief Queue the drop marker if output has been lost
+     */
+    void reportDropped();
+};
+
+/**
+ * @brief Sink writing to the serial line (standard output on native)
+ */
+class SerialSink : public BufferedSink {
+protected:
+    uint16_t deviceRoom(uint16_t wanted) override;
+    void deviceWrite(const uint8_t* data, uint16_t size) override;
+};
+
+/**
+ * @brief Sink keeping the latest output in RAM
+ * @tparam Size Capacity in bytes
+ *
+ * The oldest output is forgotten to make room.
+ */
+template<uint16_t Size>
+class MemorySink : public Sink {
+public:
+    void write(const uint8_t* data, uint16_t size) override {
+        if (size > Size) {
+            data += size - Size;
+            size = Size;
+        }
+        if (size > ring.available())
+            ring.pop(size - ring.available());
+        ring.push(data, size);
+    }
+
+    /**
+     * @brief Read the content, oldest first
+     * @param consumer Function receiving the content (at most two pieces)
+     */
+    void read(void (*consumer)(const uint8_t* data, uint16_t size)) const {
+        uint16_t offset = 0;
+        uint16_t length;
+        const uint8_t* chunk = ring.peek(offset, length);
+        while (length != 0) {
+            consumer(chunk, length);
+            offset += length;
+            chunk = ring.peek(offset, length);
+        }
+    }
+
+    /**
+     * @brief Amount of stored output
+     * @return Stored bytes
+     */
+    [[nodiscard]] uint16_t size() const { return ring.size(); }
+
+    /**
+     * @brief Forget everything
+     */
+    void clear() { ring.clear(); }
+
+private:
+    /// Stored output
+    RingBuffer<Size> ring;
+};
+
+/**
+ * @brief Sink giving the output to a function (e.g. a network transport)
+ */
+class CallbackSink : public Sink {
+public:
+    /// Function receiving the output
+    using Callback = void (*)(const uint8_t* data, uint16_t size);
+
+    /**
+     * @brief Constructor
+     * @param callback_ Function receiving the output
+     */
+    explicit CallbackSink(Callback callback_) :
+        callback{callback_} {}
+
+    void write(const uint8_t* data, uint16_t size) override { callback(data, size); }
+
+private:
+    /// Function receiving the output
+    Callback callback;
+};
+
+#ifdef NATIVE
+/**
+ * @brief Sink capturing the output in a string (native tests)
+ */
+class CaptureSink : public Sink {
+public:
+    void write(const uint8_t* data, uint16_t size) override { content.append(reinterpret_cast<const char*>(data), size); }
+
+    /**
+     * @brief Access to the captured output
+     * @return The output
+     */
+    [[nodiscard]] const std::string& str() const { return content; }
+
+    /**
+     * @brief Forget the captured output
+     */
+    void clear() { content.clear(); }
+
+private:
+    /// Captured output
+    std::string content;
+};
+#endif
+
+/**
+ * @brief Access to the serial sink, registered at start
+ * @return The serial sink
+ */
+SerialSink& serialSink();
+
+/**
+ * @brief Register a sink
+ * @param sink The sink
+ * @return False if there is no room left (or already registered)
+ */
+bool addSink(Sink& sink);
+
+/**
+ * @brief Unregister a sink
+ * @param sink The sink
+ */
+void removeSink(Sink& sink);
+
+/**
+ * @brief Define the output mode of the log
+ * @param mode The new mode
+ *
+ * In direct mode, every write goes to the sinks at once and the serial sink writes to the
+ * device immediately. Switching mode flushes the pending output.
+ */
+void setLogMode(const LogMode& mode);
+
+/**
+ * @brief Get the output mode of the log
+ * @return The current mode
+ */
+[[nodiscard]] LogMode getLogMode();
+
+/**
+ * @brief Define the level of the line being started
+ * @param level The line's level
+ */
+void logLevel(const Verbosity& level);
+
+/**
+ * @brief Add characters to the log output
+ * @param str The characters
+ * @param length Number of characters
+ *
+ * In buffered mode, the characters are assembled into a line which is given to the sinks
+ * once complete (or when the line buffer is full).
+ */
+void logWrite(const char* str, uint16_t length);
+
+/**
+ * @brief Add a null-terminated string to the log output
+ * @param str The string
+ */
+void logWrite(const char* str);
+
+/**
+ * @brief Add one character to the log output
+ * @param c The character
+ */
+void logPut(char c);
+
+/**
+ * @brief Add a binary record to the log output
+ * @param data The record
+ * @param length Record size
+ * @param level The record's level
+ *
+ * The incomplete text line (if any) is given to the sinks first.
+ */
+void logRecord(const uint8_t* data, uint16_t length, const Verbosity& level);
+
+/**
+ * @brief Background work of the sinks, without blocking (called from the main loop)
+ */
+void drainLog();
+
+/**
+ * @brief Write everything, including the incomplete line (blocking)
+ */
+void flushLog();
+
+/**
+ * @brief Hold the serial output: data stays in the buffer until released
+ * @param hold If the output is held
+ *
+ * Useful while the serial line carries something else. An explicit flush still writes.
+ */
+void setLogHold(bool hold);
+
+/**
+ * @brief Number of bytes waiting in the serial sink
+ * @return Pending bytes
+ */
+[[nodiscard]] uint16_t getLogPending();
+
+/**
+ * @brief Number of pieces of output dropped by the serial sink
+ * @return Dropped pieces since start
+ */
+[[nodiscard]] uint32_t getLogDropped();
+
+}// namespace sbs::io
@@ -0,0 +1,108 @@
+/**
+ * @file Node.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Node.h"
+#ifdef NATIVE
+#include "../sbs.h"
+#include <mutex>
+#include <thread>
+
+namespace sbs {
+
+/**
+ * @brief Registered node-local variable
+ */
+struct Slot {
+    Node::Factory factory;///< Function creating a value
+    Node::Deleter deleter;///< Function destroying a value
+    const void* prototype;///< Argument of the factory
+};
+
+/**
+ * @brief Registry of the node-local variables
+ */
+struct SlotRegistry {
+    std::mutex mutex;       ///< Protection of the registrations made while nodes run
+    std::vector<Slot> slots;///< The variables
+};
+
+/**
+ * @brief Access to the registry (built at its first use, during the static initialization)
+ * @return The registry
+ */
+static SlotRegistry& registry() {
+    static SlotRegistry instance;
+    return instance;
+}
+
+thread_local Node* Node::currentNode = nullptr;
+
+Node::Node(Function setup_, Function loop_) :
+    setupFunction{setup_}, loopFunction{loop_} {}
+
+Node::~Node() {
+    std::lock_guard<std::mutex> lock{registry().mutex};
+    for (size_t slot = 0; slot < values.size(); ++slot) {
+        if (values[slot] != nullptr) registry().slots[slot].deleter(values[slot]);
+    }
+}
+
+Node& Node::main() {
+    static Node instance{&sbs::setup, &sbs::loop};
+    return instance;
+}
+
+uint16_t Node::addSlot(Factory factory, Deleter deleter, const void* prototype) {
+    std::lock_guard<std::mutex> lock{registry().mutex};
+    registry().slots.push_back({factory, deleter, prototype});
+    return static_cast<uint16_t>(registry().slots.size() - 1);
+}
+
+void* Node::create(uint16_t slot) {
+    Slot entry{};
+    {
+        std::lock_guard<std::mutex> lock{registry().mutex};
+        entry = registry().slots[slot];
+    }
+    if (values.size() <= slot) values.resize(slot + 1U, nullptr);
+    // the values may use other node-local variables: the node is entered for the creation
+    NodeScope scope{*this};
+    values[slot] = entry.factory(entry.prototype);
+    return values[slot];
+}
+
+void runNodes(Node* const* nodes, uint32_t count, uint32_t threads) {
+    if (count == 0) return;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    if (threads > count) threads = count;
+    std::atomic<uint32_t> next{0};
+    std::atomic<uint32_t> running{0};
+    for (uint32_t index = 0; index < count; ++index) {
+        if (nodes[index]->isRunning()) ++running;
+    }
+    auto worker = [&]() {
+        while (running != 0) {
+            Node& node = *nodes[next++ % count];
+            if (!node.isRunning() || node.busy.exchange(true)) continue;
+            // checked again: the node may have stopped on another thread
+            if (node.isRunning() && !node.step()) --running;
+            node.busy = false;
+        }
+    };
+    std::vector<std::thread> pool;
+    for (uint32_t index = 1; index < threads; ++index)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool)
+        thread.join();
+}
+
+}// namespace sbs
+
+#endif
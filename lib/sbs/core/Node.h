@@ -0,0 +1,270 @@
+/**
+ * @file Node.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+#ifdef NATIVE
+#include <atomic>
+#include <vector>
+#endif
+
+namespace sbs {
+
+#ifdef NATIVE
+
+/**
+ * @brief Context of a simulated node (native only)
+ *
+ * The state of the library (scheduler, timers, event loop, log routing and verbosity,
+ * virtual clock, emulated devices, main loop flags) is held by node-local variables (see
+ * NodeLocal): each node has its own copy. A thread runs one node at a time, the node
+ * given by NodeScope, or else the main node of the process (the one of main() and of the
+ * tests). Each node runs its own setup and loop functions.
+ *
+ * A harness runs many nodes on a few threads with runNodes: the nodes should then use the
+ * virtual clock (time::setVirtualTime), their sleeps advancing their own time instead of
+ * blocking the thread. The RAM calibration cache is also node-local, but the files
+ * behind the storages (flash log, saved calibration cache) stay shared by the process.
+ */
+class Node {
+public:
+    /// Setup or loop function of a node
+    using Function = void (*)();
+    /// Function creating the value of a node-local variable
+    using Factory = void* (*) (const void* prototype);
+    /// Function destroying the value of a node-local variable
+    using Deleter = void (*)(void* data);
+
+    /**
+     * @brief Constructor
+     * @param setup_ Function called once at the start
+     * @param loop_ Function called at each turn of the main loop
+     */
+    Node(Function setup_, Function loop_);
+    Node(const Node&)            = delete;
+    Node(Node&&)                 = delete;
+    Node& operator=(const Node&) = delete;
+    Node& operator=(Node&&)      = delete;
+    ~Node();
+
+    /**
+     * @brief Start the node: run its setup
+     */
+    void start();
+
+    /**
+     * @brief Run one turn of the node's main loop (starts the node if needed)
+     * @return False once the node killed its loop
+     */
+    bool step();
+
+    /**
+     * @brief Check if the node has started
+     * @return True if started
+     */
+    [[nodiscard]] bool isStarted() const { return started; }
+
+    /**
+     * @brief Check if the node's loop runs
+     * @return False once the node killed its loop
+     */
+    [[nodiscard]] bool isRunning() const { return running; }
+
+    /**
+     * @brief Get the return code of the node (see setExecReturn)
+     * @return The return code
+     */
+    [[nodiscard]] int32_t getReturnCode() const { return returnCode; }
+
+    /**
+     * @brief Access to the node of the calling thread
+     * @return The current node
+     */
+    static Node& current() { return currentNode != nullptr ? *currentNode : main(); }
+
+    /**
+     * @brief Access to the main node of the process
+     * @return The main node
+     */
+    static Node& main();
+
+    /**
+     * @brief Value of a node-local variable in this node
+     * @param slot The variable
+     * @return The value (created at the first access)
+     */
+    void* data(uint16_t slot) {
+        if (slot < values.size() && values[slot] != nullptr) return values[slot];
+        return create(slot);
+    }
+
+    /**
+     * @brief Register a node-local variable
+     * @param factory Function creating a value
+     * @param deleter Function destroying a value
+     * @param prototype Argument of the factory
+     * @return The slot of the variable
+     */
+    static uint16_t addSlot(Factory factory, Deleter deleter, const void* prototype);
+
+private:
+    friend class NodeScope;
+    /// Node of the calling thread (nullptr for the main node)
+    static thread_local Node* currentNode;
+    /// Values of the node-local variables
+    std::vector<void*> values;
+    /// Setup function
+    Function setupFunction;
+    /// Loop function
+    Function loopFunction;
+    /// If the setup has run
+    bool started = false;
+    /// If the loop runs
+    std::atomic<bool> running{true};
+    /// Return code of the node
+    int32_t returnCode = 0;
+    /// If a thread runs the node (see runNodes)
+    std::atomic<bool> busy{false};
+
+    /**
+     * @brief Create the value of a node-local variable
+     * @param slot The variable
+     * @return The value
+     */
+    void* create(uint16_t slot);
+
+    friend void runNodes(Node* const* nodes, uint32_t count, uint32_t threads);
+};
+
+/**
+ * @brief Make a node the current one of the thread, for the scope's life
+ */
+class NodeScope {
+public:
+    /**
+     * @brief Constructor
+     * @param node The node to enter
+     */
+    explicit NodeScope(Node& node) :
+        previous{Node::currentNode} { Node::currentNode = &node; }
+    NodeScope(const NodeScope&)            = delete;
+    NodeScope(NodeScope&&)                 = delete;
+    NodeScope& operator=(const NodeScope&) = delete;
+    NodeScope& operator=(NodeScope&&)      = delete;
+    ~NodeScope() { Node::currentNode = previous; }
+
+private:
+    /// Node to restore
+    Node* previous;
+};
+
+/**
+ * @brief Run nodes on a pool of threads until each one kills its loop
+ * @param nodes The nodes
+ * @param count Number of nodes
+ * @param threads Number of threads (0 for one per hardware thread)
+ *
+ * The threads take the nodes in turn and run one turn of their loop; a node never runs
+ * on two threads at once.
+ */
+void runNodes(Node* const* nodes, uint32_t count, uint32_t threads = 0);
+
+/**
+ * @brief Variable with one value per node
+ * @tparam T Type of the value
+ *
+ * Each node creates its value at the first access, default constructed or copied from the
+ * prototype given to the constructor. The variables are meant to be static.
+ */
+template<typename T>
+class NodeLocal {
+public:
+    NodeLocal() :
+        slot{Node::addSlot(&construct, &destroy, nullptr)} {}
+    /**
+     * @brief Constructor
+     * @param initial Value of the variable in each node
+     */
+    explicit NodeLocal(const T& initial) :
+        prototype{initial}, slot{Node::addSlot(&copy, &destroy, &prototype)} {}
+
+    /**
+     * @brief Value in the current node
+     * @return The value
+     */
+    T& get() { return *static_cast<T*>(Node::current().data(slot)); }
+    /**
+     * @brief Member access to the value in the current node
+     * @return The value
+     */
+    T* operator->() { return &get(); }
+
+private:
+    /// Value copied in each node
+    T prototype{};
+    /// The slot of the variable
+    uint16_t slot;
+
+    /**
+     * @brief Create a default value
+     * @return The value
+     */
+    static void* construct(const void*) { return new T(); }
+    /**
+     * @brief Create a copy of the prototype
+     * @param source The prototype
+     * @return The value
+     */
+    static void* copy(const void* source) { return new T(*static_cast<const T*>(source)); }
+    /**
+     * @brief Destroy a value
+     * @param data The value
+     */
+    static void destroy(void* data) { delete static_cast<T*>(data); }
+};
+
+#else
+
+/**
+ * @brief Variable with one value per node (one node only on the boards)
+ * @tparam T Type of the value
+ */
+template<typename T>
+class NodeLocal {
+public:
+    constexpr NodeLocal() = default;
+    /**
+     * @brief Constructor
+     * @param initial Value of the variable
+     */
+    constexpr explicit NodeLocal(const T& initial) :
+        value{initial} {}
+
+    /**
+     * @brief The value
+     * @return The value
+     */
+    T& get() { return value; }
+    /**
+     * @brief Member access to the value
+     * @return The value
+     */
+    T* operator->() { return &value; }
+
+private:
+    /// The value
+    T value{};
+};
+
+#endif
+
+}// namespace sbs
@@ -7,65 +7,121 @@
  */
 
 #include "Print.h"
-#include "math/functions.h"
-#ifdef NATIVE
-#include <iostream>
-#else
-#include <Arduino.h>
-#endif
+#include "Format.h"
+#include "LogSink.h"
+#include "Node.h"
+#include "time/timing.h"
+#include <string.h>
 namespace sbs::io {
 /**
- * @brief Global verbosity level
+ * @brief State of the printing
+ */
+struct PrintState {
+    Verbosity verbose  = Verbosity::Error;///< Global verbosity level
+    bool unmutedPrefix = true;            ///< if we should print
+    LogStamp stamps    = LogStamp::None;  ///< Stamps added at the beginning of the lines
+    uint16_t sequence  = 0;               ///< Sequence number of the next line
+};
+/// State of the printing of each node
+static NodeLocal<PrintState> state;
+
+/**
+ * @brief Print the stamps of a new line
+ */
+static void printStamps() {
+    char buffer[format::maxFormatSize];
+    if ((static_cast<uint8_t>(state->stamps) & static_cast<uint8_t>(LogStamp::Time)) != 0) {
+        const uint64_t now = time::micros64();
+        buffer[0]          = '[';
+        uint8_t size       = 1 + format::toDecimal(buffer + 1, now / 1000000U);
+        buffer[size++]     = '.';
+        // 6 digits of microseconds
+        uint8_t digits = format::toDecimal(buffer + size + 6, static_cast<uint64_t>(now % 1000000U));
+        memset(buffer + size, '0', 6 - digits);
+        memmove(buffer + size + 6 - digits, buffer + size + 6, digits);
+        size += 6;
+        buffer[size++] = ']';
+        buffer[size++] = ' ';
+        logWrite(buffer, size);
+    }
+    if ((static_cast<uint8_t>(state->stamps) & static_cast<uint8_t>(LogStamp::Sequence)) != 0) {
+        buffer[0]      = '#';
+        uint8_t size   = 1 + format::toDecimal(buffer + 1, static_cast<uint64_t>(nextLogSequence()));
+        buffer[size++] = ' ';
+        logWrite(buffer, size);
+    }
+}
+
+/**
+ * @brief Start a line if needed
+ * @param level The line's level (for the sinks' filters)
+ * @param prefix The level prefix
  */
-static Verbosity verbose = Verbosity::Error;
-/// if we should print
-static bool unmutedPrefix = true;
+static void startLine(const Verbosity& level, const char* prefix) {
+    if (!state->unmutedPrefix) return;
+    logLevel(level);
+    if (state->stamps != LogStamp::None) printStamps();
+    logWrite(prefix);
+    state->unmutedPrefix = false;
+}
+
 /**
  * @brief Internal function to print line prefix
  * @param verbosity Message's verbosity level
  * @return If message should be print
  */
 bool printPrefix(const Verbosity& verbosity) {
-    if (verbose == Verbosity::Mute) return false;
+    if (state->verbose == Verbosity::Mute) return false;
     if (verbosity == Verbosity::Error) {
-        if (unmutedPrefix) {
-#ifdef NATIVE
-            std::cout << "ERROR ";
-#else
-            Serial.print(F("ERROR "));
-#endif
-            unmutedPrefix = false;
-        }
+        startLine(Verbosity::Error, "ERROR ");
         return true;
     }
-    if (verbosity == Verbosity::Warning && verbose != Verbosity::Error) {
-        if (unmutedPrefix) {
-#ifdef NATIVE
-            std::cout << "WARNING ";
-#else
-            Serial.print(F("WARNING "));
-#endif
-            unmutedPrefix = false;
-        }
+    if (verbosity == Verbosity::Warning && state->verbose != Verbosity::Error) {
+        startLine(Verbosity::Warning, "WARNING ");
         return true;
     }
-    if (verbosity == Verbosity::Debug && verbose == Verbosity::Debug) {
-        if (unmutedPrefix) {
-#ifdef NATIVE
-            std::cout << "DEBUG ";
-#else
-            Serial.print(F("DEBUG "));
-#endif
-            unmutedPrefix = false;
-        }
+    if (verbosity == Verbosity::Debug && state->verbose == Verbosity::Debug) {
+        startLine(Verbosity::Debug, "DEBUG ");
         return true;
     }
-    unmutedPrefix = false;
-    return verbosity == Verbosity::Mute;
+    if (verbosity == Verbosity::Mute) {
+        startLine(Verbosity::Mute, "");
+        return true;
+    }
+    state->unmutedPrefix = false;
+    return false;
+}
+
+void setLogStamp(const LogStamp& stamp) {
+    state->stamps = stamp;
+}
+
+LogStamp getLogStamp() {
+    return state->stamps;
+}
+
+uint16_t nextLogSequence() {
+    return state->sequence++;
 }
 
 void setVerbosity(const Verbosity& verb) {
-    verbose = verb;
+    state->verbose = verb;
+}
+
+Verbosity getVerbosity() {
+    return state->verbose;
+}
+
+bool isLogged(const Verbosity& verbosity) {
+    if (state->verbose == Verbosity::Mute) return false;
+    switch (verbosity) {
+        case Verbosity::Warning:
+            return state->verbose != Verbosity::Error;
+        case Verbosity::Debug:
+            return state->verbose == Verbosity::Debug;
+        default:
+            return true;
+    }
 }
 
 /**
@@ -75,11 +131,15 @@ void setVerbosity(const Verbosity& verb) {
  */
 void print(const char* str, const Verbosity& verbosity) {
     if (!printPrefix(verbosity)) return;
-#ifdef NATIVE
-    std::cout << str;
-#else
-    Serial.print(str);
-#endif
+    logWrite(str);
+}
+
+void printLine(const char* str, uint16_t length, const Verbosity& verbosity) {
+    if (printPrefix(verbosity)) {
+        logWrite(str, length);
+        logPut('\n');
+    }
+    state->unmutedPrefix = true;
 }
 
 /**
@@ -91,52 +151,6 @@ void print(const string& str, const Verbosity& verbosity) {
     print(str.c_str(), verbosity);
 }
 
-/**
- * @brief Print a single char
- * @param c The char to print
- */
-void printChar(char c){
-#ifdef NATIVE
-    std::cout << c;
-#else
-    Serial.print(c);
-#endif
-}
-
-/**
- * @brief Print integer as bits
- * @tparam T The integer type
- * @param data The Integer to print
- */
-template<class T>
-void toBits(const T& data) {
-    uint8_t bits    = sizeof(T) * 8;
-    uint64_t cursor = 1ULL << (bits - 1);
-    while (cursor != 0) {
-        printChar((data & cursor) ? '1' : '0');
-        cursor >>= 1;
-    }
-}
-/// List of hexadecimal digits
-const char digits[] = "0123456789ABCDEF";
-
-/**
- * @brief Print integer in Hex format
- * @tparam T The integer type
- * @param data The integer to print
- */
-template<class T>
-void toHex(const T& data) {
-    uint8_t octets  = sizeof(T) * 2;
-    uint8_t ggg = octets-1;
-    uint64_t cursor = 15ULL << (ggg* 4);
-    while (cursor != 0) {
-        printChar(digits[(data & cursor)>>(4*ggg)]);
-        cursor >>= 4;
-        --ggg;
-    }
-}
-
 /**
  * @brief Internal function for printing integer
  * @tparam BaseType Integer Type
@@ -147,19 +161,18 @@ void toHex(const T& data) {
 template<class BaseType>
 void print(BaseType data, const IntFormat& format, const Verbosity& verbosity) {
     if (!printPrefix(verbosity)) return;
+    char buffer[format::maxFormatSize];
+    uint8_t size;
     if (format == IntFormat::Binary) {
-        toBits(data);
-        return;
+        size = format::toBinary(buffer, static_cast<uint64_t>(data), sizeof(BaseType));
+    } else if (format == IntFormat::Hexadecimal) {
+        size = format::toHexadecimal(buffer, static_cast<uint64_t>(data), sizeof(BaseType));
+    } else if (static_cast<BaseType>(-1) < static_cast<BaseType>(0)) {
+        size = format::toDecimal(buffer, static_cast<int64_t>(data));
+    } else {
+        size = format::toDecimal(buffer, static_cast<uint64_t>(data));
     }
-    if (format == IntFormat::Hexadecimal) {
-        toHex(data);
-        return;
-    }
-#ifdef NATIVE
-    std::cout << static_cast<int32_t>(data);
-#else
-    Serial.print(static_cast<int32_t>(data));
-#endif
+    logWrite(buffer, size);
 }
 
 /**
@@ -170,47 +183,8 @@ void print(BaseType data, const IntFormat& format, const Verbosity& verbosity) {
  */
 void print(double data, uint8_t digit, const Verbosity& verbosity) {
     if (!printPrefix(verbosity)) return;
-    if (math::isnan(data)) {
-        print("nan", Verbosity::Mute);
-        return;
-    }
-    if (math::isinf(data)) {
-        print("inf", Verbosity::Mute);
-        return;
-    }
-    if (data > 4294967040.0) {
-        print("ovf", Verbosity::Mute);// constant determined empirically
-        return;
-    }
-    if (data < -4294967040.0) {
-        print("ovf", Verbosity::Mute);// constant determined empirically
-        return;
-    }
-    // Handle negative numbers
-    if (data < 0.0) {
-        print("-", Verbosity::Mute);
-        data = -data;
-    }
-    // Round correctly so that print(1.999, 2) prints as "2.00"
-    double rounding = 0.5;
-    for (uint8_t i = 0; i < digit; ++i)
-        rounding /= 10.0;
-    data += rounding;
-    // Extract the integer part of the number and print it
-    auto int_part    = static_cast<uint32_t>(data);
-    double remainder = data - static_cast<double>(int_part);
-    print(int_part, IntFormat::Decimal, Verbosity::Mute);
-    // Print the decimal point, but only if there are digits beyond
-    if (digit > 0) {
-        print(".", Verbosity::Mute);
-    }
-    // Extract digits from the remainder one at a time
-    while (digit-- > 0) {
-        remainder *= 10.0;
-        auto toPrint = static_cast<unsigned int>(remainder);
-        print(toPrint, IntFormat::Decimal, Verbosity::Mute);
-        remainder -= toPrint;
-    }
+    char buffer[format::maxFormatSize];
+    logWrite(buffer, format::toFixed(buffer, data, digit));
 }
 
 void logger(const char* str) { print(str, Verbosity::Mute); }
@@ -224,7 +198,7 @@ void logger(int32_t data, const IntFormat& format) { print(data, format, Verbosi
 void logger(uint64_t data, const IntFormat& format) { print(data, format, Verbosity::Mute); }
 void logger(int64_t data, const IntFormat& format) { print(data, format, Verbosity::Mute); }
 void logger(double data, uint8_t digit) { print(data, digit, Verbosity::Mute); }
-void loggerln() {print("\n", Verbosity::Mute);unmutedPrefix = true;}
+void loggerln() {print("\n", Verbosity::Mute);state->unmutedPrefix = true;}
 void loggerln(const char* str) { logger(str); loggerln();}
 void loggerln(const string& str) { logger(str); loggerln();}
 void loggerln(uint8_t data, const IntFormat& format) {  logger(data, format); loggerln();}
@@ -237,6 +211,7 @@ void loggerln(uint64_t data, const IntFormat& format) { logger(data, format); lo
 void loggerln(int64_t data, const IntFormat& format) {  logger(data, format); loggerln();}
 void loggerln(double data, uint8_t digit) { logger(data, digit); loggerln();}
 
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_ERROR
 void error(const char* str) { print(str, Verbosity::Error); }
 void error(const string& str) { print(str, Verbosity::Error); }
 void error(uint8_t data, const IntFormat& format) { print(data, format, Verbosity::Error); }
@@ -248,7 +223,7 @@ void error(int32_t data, const IntFormat& format) { print(data, format, Verbosit
 void error(uint64_t data, const IntFormat& format) { print(data, format, Verbosity::Error); }
 void error(int64_t data, const IntFormat& format) { print(data, format, Verbosity::Error); }
 void error(double data, uint8_t digit) { print(data, digit, Verbosity::Error); }
-void errorln() {print("\n", Verbosity::Error);unmutedPrefix = true;}
+void errorln() {print("\n", Verbosity::Error);state->unmutedPrefix = true;}
 void errorln(const char* str) { error(str); errorln();}
 void errorln(const string& str) { error(str); errorln();}
 void errorln(uint8_t data, const IntFormat& format) {  error(data, format); errorln();}
@@ -264,7 +239,9 @@ void errorln(double data, uint8_t digit) {
     error(data, digit);
     errorln();
 }
+#endif
 
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_WARNING
 void warning(const char* str) { print(str, Verbosity::Warning); }
 void warning(const string& str) { print(str, Verbosity::Warning); }
 void warning(uint8_t data, const IntFormat& format) { print(data, format, Verbosity::Warning); }
@@ -276,7 +253,7 @@ void warning(int32_t data, const IntFormat& format) { print(data, format, Verbos
 void warning(uint64_t data, const IntFormat& format) { print(data, format, Verbosity::Warning); }
 void warning(int64_t data, const IntFormat& format) { print(data, format, Verbosity::Warning); }
 void warning(double data, uint8_t digit) { print(data, digit, Verbosity::Warning); }
-void warningln() {print("\n", Verbosity::Warning);unmutedPrefix = true;}
+void warningln() {print("\n", Verbosity::Warning);state->unmutedPrefix = true;}
 void warningln(const char* str) { warning(str); warningln();}
 void warningln(const string& str) { warning(str); warningln(); }
 void warningln(uint8_t data, const IntFormat& format) { warning(data, format); warningln(); }
@@ -288,8 +265,9 @@ void warningln(int32_t data, const IntFormat& format) { warning(data, format); w
 void warningln(uint64_t data, const IntFormat& format) { warning(data, format); warningln(); }
 void warningln(int64_t data, const IntFormat& format) { warning(data, format); warningln(); }
 void warningln(double data, uint8_t digit) { warning(data, digit); warningln(); }
+#endif
 
-
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_DEBUG
 void debug(const char* str) { print(str, Verbosity::Debug); }
 void debug(const string& str) { print(str, Verbosity::Debug); }
 void debug(uint8_t data, const IntFormat& format) { print(data, format, Verbosity::Debug); }
@@ -301,7 +279,7 @@ void debug(int32_t data, const IntFormat& format) { print(data, format, Verbosit
 void debug(uint64_t data, const IntFormat& format) { print(data, format, Verbosity::Debug); }
 void debug(int64_t data, const IntFormat& format) { print(data, format, Verbosity::Debug); }
 void debug(double data, uint8_t digit) { print(data, digit, Verbosity::Debug); }
-void debugln() {print("\n", Verbosity::Debug);unmutedPrefix = true;}
+void debugln() {print("\n", Verbosity::Debug);state->unmutedPrefix = true;}
 void debugln(const char* str) { debug(str); debugln();}
 void debugln(const string& str) { debug(str); debugln();}
 void debugln(uint8_t data, const IntFormat& format) { debug(data, format); debugln();}
@@ -313,5 +291,6 @@ void debugln(int32_t data, const IntFormat& format) { debug(data, format); debug
 void debugln(uint64_t data, const IntFormat& format) { debug(data, format); debugln();}
 void debugln(int64_t data, const IntFormat& format) { debug(data, format); debugln();}
 void debugln(double data, uint8_t digit) { debug(data, digit); debugln();}
+#endif
 
 }// namespace sbs::io
\ No newline at end of file
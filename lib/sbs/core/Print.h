@@ -9,6 +9,55 @@
 #pragma once
 #include "string.h"
 
+/// Compile-time level: only plain log messages
+#define SBS_LOG_LEVEL_LOG 0
+/// Compile-time level: errors and log messages
+#define SBS_LOG_LEVEL_ERROR 1
+/// Compile-time level: warnings, errors and log messages
+#define SBS_LOG_LEVEL_WARNING 2
+/// Compile-time level: everything
+#define SBS_LOG_LEVEL_DEBUG 3
+
+/// Highest message level compiled in the whole program (build flag)
+#ifndef SBS_LOG_LEVEL
+#define SBS_LOG_LEVEL SBS_LOG_LEVEL_DEBUG
+#endif
+/// Highest message level compiled by the SBS_ macros of a translation unit (define it before any include)
+#ifndef SBS_LOG_LOCAL_LEVEL
+#define SBS_LOG_LOCAL_LEVEL SBS_LOG_LEVEL
+#endif
+
+/**
+ * @brief Logging macros
+ *
+ * Messages above the compile-time level vanish with their arguments, which are not even
+ * evaluated. The function API gets the global level only: calls to disabled functions
+ * compile to empty inline functions. The runtime verbosity still filters enabled levels.
+ */
+#define SBS_LOG(...) ::sbs::io::logger(__VA_ARGS__)
+#define SBS_LOGLN(...) ::sbs::io::loggerln(__VA_ARGS__)
+#if SBS_LOG_LOCAL_LEVEL >= SBS_LOG_LEVEL_ERROR
+#define SBS_ERROR(...) ::sbs::io::error(__VA_ARGS__)
+#define SBS_ERRORLN(...) ::sbs::io::errorln(__VA_ARGS__)
+#else
+#define SBS_ERROR(...) do {} while (0)
+#define SBS_ERRORLN(...) do {} while (0)
+#endif
+#if SBS_LOG_LOCAL_LEVEL >= SBS_LOG_LEVEL_WARNING
+#define SBS_WARNING(...) ::sbs::io::warning(__VA_ARGS__)
+#define SBS_WARNINGLN(...) ::sbs::io::warningln(__VA_ARGS__)
+#else
+#define SBS_WARNING(...) do {} while (0)
+#define SBS_WARNINGLN(...) do {} while (0)
+#endif
+#if SBS_LOG_LOCAL_LEVEL >= SBS_LOG_LEVEL_DEBUG
+#define SBS_DEBUG(...) ::sbs::io::debug(__VA_ARGS__)
+#define SBS_DEBUGLN(...) ::sbs::io::debugln(__VA_ARGS__)
+#else
+#define SBS_DEBUG(...) do {} while (0)
+#define SBS_DEBUGLN(...) do {} while (0)
+#endif
+
 namespace sbs::io {
 
 /**
@@ -30,6 +79,16 @@ enum struct Verbosity {
     Debug,  ///< Print error, warning, debug and log
 };
 
+/**
+ * @brief Stamps at the beginning of the log lines
+ */
+enum struct LogStamp : uint8_t {
+    None     = 0,///< No stamp
+    Time     = 1,///< Time since start: `[seconds.microseconds]`
+    Sequence = 2,///< Sequence number (16 bits, wrapping): `#number`
+    Both     = 3,///< Time and sequence number
+};
+
 /**
  * @brief Print string as log verbosity
  * @param str The string to print
@@ -165,6 +224,7 @@ void loggerln(int64_t data, const io::IntFormat& format = io::IntFormat::Auto);
  */
 void loggerln(double data, uint8_t digit = 2);
 
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_ERROR
 /**
  * @brief Print string as error verbosity
  * @param str The string to print
@@ -301,8 +361,20 @@ void errorln(int64_t data, const io::IntFormat& format = io::IntFormat::Auto);
  * @param digit The number of digits to print
  */
 void errorln(double data, uint8_t digit = 2);
+#else
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void error(const Args&...) {}
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void errorln(const Args&...) {}
+#endif
 
-
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_WARNING
 /**
  * @brief Print string as warning verbosity
  * @param str The string to print
@@ -438,7 +510,20 @@ void warningln(int64_t data, const io::IntFormat& format = io::IntFormat::Auto);
  * @param digit The number of digits to print
  */
 void warningln(double data, uint8_t digit = 2);
+#else
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void warning(const Args&...) {}
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void warningln(const Args&...) {}
+#endif
 
+#if SBS_LOG_LEVEL >= SBS_LOG_LEVEL_DEBUG
 /**
  * @brief Print string as debug verbosity
  * @param str The string to print
@@ -575,6 +660,18 @@ void debugln(int64_t data, const io::IntFormat& format = io::IntFormat::Auto);
  * @param digit The number of digits to print
  */
 void debugln(double data, uint8_t digit = 2);
+#else
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void debug(const Args&...) {}
+/**
+ * @brief Disabled at compile time
+ */
+template<class... Args>
+inline void debugln(const Args&...) {}
+#endif
 
 /**
  * @brief Define the global verbosity level
@@ -582,4 +679,45 @@ void debugln(double data, uint8_t digit = 2);
  */
 void setVerbosity(const io::Verbosity& verb);
 
+/**
+ * @brief Print a complete line with a single prefix
+ * @param str The line content (without return line)
+ * @param length The content size
+ * @param verbosity The message's level (Mute for log messages)
+ */
+void printLine(const char* str, uint16_t length, const io::Verbosity& verbosity);
+
+/**
+ * @brief Define the stamps at the beginning of the log lines
+ * @param stamp The stamps
+ */
+void setLogStamp(const io::LogStamp& stamp);
+
+/**
+ * @brief Get the stamps at the beginning of the log lines
+ * @return The stamps
+ */
+[[nodiscard]] LogStamp getLogStamp();
+
+/**
+ * @brief Get the next sequence number (shared by text lines and binary records)
+ * @return The sequence number
+ *
+ * A gap in the sequence numbers received by the host shows lost lines.
+ */
+uint16_t nextLogSequence();
+
+/**
+ * @brief Get the global verbosity level
+ * @return The verbosity
+ */
+[[nodiscard]] Verbosity getVerbosity();
+
+/**
+ * @brief Check if a message of the given level is printed
+ * @param verbosity The message's level (Mute for log messages)
+ * @return True if the message is printed
+ */
+[[nodiscard]] bool isLogged(const io::Verbosity& verbosity);
+
 }// namespace sbs::io
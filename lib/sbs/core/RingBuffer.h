@@ -0,0 +1,134 @@
+/**
+ * @file RingBuffer.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+namespace sbs {
+
+/**
+ * @brief Fixed-size byte ring buffer
+ * @tparam Size Capacity in bytes
+ *
+ * Single producer, single consumer. Writes are all-or-nothing so that a record is
+ * never cut by a full buffer.
+ */
+template<uint16_t Size>
+class RingBuffer {
+public:
+    static_assert(Size > 1, "Ring buffer too small");
+
+    /**
+     * @brief Number of stored bytes
+     * @return Stored bytes
+     */
+    [[nodiscard]] uint16_t size() const { return count; }
+
+    /**
+     * @brief Number of free bytes
+     * @return Free bytes
+     */
+    [[nodiscard]] uint16_t available() const { return Size - count; }
+
+    /**
+     * @brief Capacity
+     * @return The capacity
+     */
+    [[nodiscard]] static constexpr uint16_t capacity() { return Size; }
+
+    /**
+     * @brief Check for content
+     * @return True if empty
+     */
+    [[nodiscard]] bool empty() const { return count == 0; }
+
+    /**
+     * @brief Add bytes
+     * @param data The bytes
+     * @param length Number of bytes
+     * @return False if not enough space (nothing written)
+     */
+    bool push(const uint8_t* data, uint16_t length) {
+        if (length > available())
+            return false;
+        for (uint16_t i = 0; i < length; ++i) {
+            buffer[tail] = data[i];
+            tail         = next(tail);
+        }
+        count += length;
+        return true;
+    }
+
+    /**
+     * @brief Get the longest contiguous chunk of stored bytes
+     * @param length Output: chunk size
+     * @return Pointer to the chunk
+     */
+    [[nodiscard]] const uint8_t* peek(uint16_t& length) const {
+        length = (head + count > Size) ? Size - head : count;
+        return buffer + head;
+    }
+
+    /**
+     * @brief Get the longest contiguous chunk of stored bytes after the first ones
+     * @param offset Number of bytes to skip
+     * @param length Output: chunk size (0 if nothing after offset)
+     * @return Pointer to the chunk
+     */
+    [[nodiscard]] const uint8_t* peek(uint16_t offset, uint16_t& length) const {
+        if (offset >= count) {
+            length = 0;
+            return buffer;
+        }
+        const auto start    = static_cast<uint16_t>((static_cast<uint32_t>(head) + offset) % Size);
+        const uint16_t rest = count - offset;
+        length              = (start + rest > Size) ? Size - start : rest;
+        return buffer + start;
+    }
+
+    /**
+     * @brief Remove bytes from the front
+     * @param length Number of bytes to remove
+     */
+    void pop(uint16_t length) {
+        if (length > count) length = count;
+        head = static_cast<uint16_t>((static_cast<uint32_t>(head) + length) % Size);
+        count -= length;
+    }
+
+    /**
+     * @brief Remove everything
+     */
+    void clear() {
+        head  = 0;
+        tail  = 0;
+        count = 0;
+    }
+
+private:
+    /// Storage
+    uint8_t buffer[Size] = {};
+    /// Read position
+    uint16_t head = 0;
+    /// Write position
+    uint16_t tail = 0;
+    /// Stored bytes
+    uint16_t count = 0;
+    /**
+     * @brief Next position in the ring
+     * @param pos Current position
+     * @return Next position
+     */
+    static uint16_t next(uint16_t pos) { return pos + 1 == Size ? 0 : pos + 1; }
+};
+
+}// namespace sbs
@@ -7,57 +7,160 @@
  */
 
 #include "../sbs.h"
+#include "core/EventLoop.h"
+#include "core/LogLine.h"
+#include "core/LogSink.h"
+#include "core/Node.h"
 #include "core/Print.h"
+#include "io/CalibrationCache.h"
+#include "time/LoopMonitor.h"
+#include "time/Profiler.h"
+#include "time/Scheduler.h"
+#include "time/TimerWheel.h"
+#include "time/Watchdog.h"
 
-/// If the main loop should continue
-static bool looping   = true;
-/// The return code
-static int32_t returnCode = 0;
+/**
+ * @brief State of the main loop
+ */
+struct MainState {
+    bool looping       = true;///< If the main loop should continue
+    int32_t returnCode = 0;   ///< The return code
+};
+
+/// The main loop state of each node
+static sbs::NodeLocal<MainState> mainState;
 
 namespace sbs {
 
 void setExecReturn(int _returnCode) {
-    returnCode = _returnCode;
+    mainState->returnCode = _returnCode;
 }
 
 void killLoop() {
-    looping = false;
+    mainState->looping = false;
 }
 
 }// namespace sbs
 
 #ifdef ARDUINO
-
 #include <Arduino.h>
 
-void setup() {
+/**
+ * @brief Event source of the serial reception: one event when data arrives
+ */
+static void serialSource() {
+    static bool received = false;
+    const bool available = Serial.available() > 0;
+    if (available && !received) sbs::events().post(sbs::SystemEvent::SerialRx, static_cast<uint16_t>(Serial.available()));
+    received = available;
+}
+#endif
+
+/**
+ * @brief Start the system
+ * @param setupFunction The setup of the application
+ */
+static void startSystem(void (*setupFunction)()) {
     sbs::io::loggerln("System Starting");
-    sbs::setup();
+#ifdef ARDUINO
+    sbs::events().addSource(&serialSource);
+#endif
+    sbs::time::ResetRecord record{};
+    if (sbs::time::Watchdog::getLastReset(record)) {
+        const char* culprit = record.culprit;
+        sbs::io::log(sbs::io::Verbosity::Warning, record.cause == sbs::time::ResetCause::Hang ? "Watchdog reset (hang):" : "Watchdog reset (deadline):",
+                     sbs::io::field("culprit", culprit), sbs::io::field("uptime", record.uptime));
+    }
+#if SBS_CALIBRATION_RESTORE
+    // before the sensors initialization in the setup
+    sbs::io::calibration::restore();
+#endif
+    setupFunction();
     sbs::io::loggerln("System Started");
 }
 
+/**
+ * @brief One turn of the main loop
+ * @param loopFunction The loop of the application
+ */
+static void runLoop(void (*loopFunction)()) {
+    // counts the wraps of the hardware clock
+    sbs::time::micros64();
+    sbs::time::loopMonitor().begin();
+    sbs::events().poll();
+    {
+        SBS_PROFILE_ZONE("events");
+        sbs::events().dispatch();
+    }
+    {
+        SBS_PROFILE_ZONE("loop");
+        loopFunction();
+    }
+    {
+        SBS_PROFILE_ZONE("timers");
+        sbs::time::timers().update();
+    }
+    sbs::time::scheduler().update();
+    {
+        SBS_PROFILE_ZONE("log");
+        sbs::io::drainLog();
+    }
+    sbs::time::loopMonitor().end();
+    sbs::time::watchdog().update();
+#if SBS_PROFILING
+    sbs::time::profiler().update();
+#endif
+}
+
+#ifdef ARDUINO
+
+void setup() {
+    startSystem(&sbs::setup);
+}
+
 void loop() {
-    sbs::loop();
-    if (!looping) {
-        looping = true;
+    runLoop(&sbs::loop);
+    if (!mainState->looping) {
+        mainState->looping = true;
         sbs::io::logger("Return Code: ");
+        // the setup registers its tasks again
+        sbs::time::scheduler().clear();
         setup();
     }
 }
 #else
+namespace sbs {
+
+void Node::start() {
+    const NodeScope scope{*this};
+    started = true;
+    startSystem(setupFunction);
+    running    = mainState->looping;
+    returnCode = mainState->returnCode;
+}
+
+bool Node::step() {
+    if (!started) start();
+    if (!running) return false;
+    const NodeScope scope{*this};
+    runLoop(loopFunction);
+    running    = mainState->looping;
+    returnCode = mainState->returnCode;
+    return running;
+}
+
+}// namespace sbs
+
 /**
  * @brief Main entry point for non-Arduino builds
  * @return Return code
  */
 int main() {
-    sbs::io::loggerln("System Starting");
-    sbs::setup();
-    sbs::io::loggerln("System Started");
-    while (looping) {
-        sbs::loop();
-    }
+    sbs::Node& node = sbs::Node::main();
+    while (node.step()) {}
     sbs::io::logger("Return Code: ");
-    sbs::io::loggerln(returnCode);
-    return returnCode;
+    sbs::io::loggerln(node.getReturnCode());
+    sbs::io::flushLog();
+    return node.getReturnCode();
 }
 #endif
@@ -0,0 +1,63 @@
+/**
+ * @file Fusion.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Fusion.h"
+
+namespace sbs::data {
+
+uint8_t SensorFusion::addSource(double measurementNoise, bool reference) {
+    if (sourceCount >= maxSources)
+        return invalidSource;
+    if (reference) {
+        for (uint8_t i = 0; i < sourceCount; ++i)
+            sources[i].reference = false;
+    }
+    sources[sourceCount] = Source{measurementNoise, 0.0, reference || sourceCount == 0};
+    return sourceCount++;
+}
+
+double SensorFusion::update(uint8_t source, double measurement, uint32_t timestamp) {
+    if (source >= sourceCount)
+        return estimate;
+    Source& src      = sources[source];
+    double corrected = measurement - src.bias;
+    if (!initialized) {
+        estimate    = corrected;
+        covariance  = src.noise;
+        lastUpdate  = timestamp;
+        initialized = true;
+        return estimate;
+    }
+    // prediction: random walk, unsigned difference is wrap-safe
+    double elapsed = static_cast<double>(timestamp - lastUpdate) / 1000.0;
+    lastUpdate     = timestamp;
+    covariance += processNoise * elapsed;
+    // correction
+    double innovation = corrected - estimate;
+    double gain       = covariance / (covariance + src.noise);
+    estimate += gain * innovation;
+    covariance *= (1.0 - gain);
+    // bias learning on the residual
+    if (!src.reference)
+        src.bias += biasRate * (measurement - src.bias - estimate);
+    return estimate;
+}
+
+void SensorFusion::resetBiases() {
+    for (uint8_t i = 0; i < sourceCount; ++i)
+        sources[i].bias = 0.0;
+    initialized = false;
+}
+
+void SensorFusion::setBias(uint8_t source, double bias) {
+    if (source >= sourceCount || sources[source].reference)
+        return;
+    sources[source].bias = bias;
+}
+
+}// namespace sbs::data
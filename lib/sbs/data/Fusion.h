@@ -0,0 +1,137 @@
+/**
+ * @file Fusion.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+namespace sbs::data {
+
+/**
+ * @brief Fusion of redundant measurements of one physical quantity
+ *
+ * One-dimensional Kalman filter over a random-walk model of the quantity: each source
+ * has its own measurement noise and its own bias. The bias of the reference source is
+ * fixed at 0, the biases of the others are learnt as a slow average of their innovation
+ * (complementary approach: the filter tracks fast variations, the biases absorb the
+ * constant disagreements). Every measurement of any source updates the estimate, so the
+ * output rate is the rate of the fastest source.
+ */
+class SensorFusion {
+public:
+    /// Maximum number of sources
+    static constexpr uint8_t maxSources = 4;
+    /// Value returned when a source cannot be registered
+    static constexpr uint8_t invalidSource = 0xFF;
+
+    /**
+     * @brief Constructor
+     * @param processNoise_ Variance growth of the quantity per second
+     * @param biasRate_ Bias learning rate in [0, 1] (0 freezes the biases)
+     */
+    explicit SensorFusion(double processNoise_ = 0.001, double biasRate_ = 0.01) :
+        processNoise{processNoise_}, biasRate{biasRate_} {}
+
+    /**
+     * @brief Register a new source
+     * @param measurementNoise Variance of the source's measurements
+     * @param reference If this source defines the absolute scale (bias forced to 0)
+     * @return The source identifier or invalidSource if full
+     *
+     * @note The first registered source becomes the reference if none is given.
+     */
+    uint8_t addSource(double measurementNoise, bool reference = false);
+
+    /**
+     * @brief Feed a measurement
+     * @param source The source identifier
+     * @param measurement The measured value
+     * @param timestamp Measurement date in milliseconds
+     * @return The new best estimate
+     */
+    double update(uint8_t source, double measurement, uint32_t timestamp);
+
+    /**
+     * @brief Forget the estimate (biases are kept)
+     */
+    void reset() { initialized = false; }
+
+    /**
+     * @brief Forget the estimate and the learnt biases
+     */
+    void resetBiases();
+
+    /**
+     * @brief Check if an estimate exists
+     * @return True if at least one measurement got in
+     */
+    [[nodiscard]] bool ready() const { return initialized; }
+
+    /**
+     * @brief Get the best estimate
+     * @return The estimate
+     */
+    [[nodiscard]] double value() const { return estimate; }
+
+    /**
+     * @brief Get the estimate's variance
+     * @return The variance
+     */
+    [[nodiscard]] double variance() const { return covariance; }
+
+    /**
+     * @brief Get the learnt bias of a source
+     * @param source The source identifier
+     * @return The bias
+     */
+    [[nodiscard]] double getBias(uint8_t source) const { return source < sourceCount ? sources[source].bias : 0.0; }
+
+    /**
+     * @brief Define the bias of a source (e.g. from a previous session)
+     * @param source The source identifier
+     * @param bias The bias
+     */
+    void setBias(uint8_t source, double bias);
+
+    /**
+     * @brief Number of registered sources
+     * @return Number of sources
+     */
+    [[nodiscard]] uint8_t size() const { return sourceCount; }
+
+private:
+    /**
+     * @brief Source data
+     */
+    struct Source {
+        double noise   = 1.0;  ///< Measurement variance
+        double bias    = 0.0;  ///< Learnt bias
+        bool reference = false;///< If the bias is forced to 0
+    };
+    /// Registered sources
+    Source sources[maxSources];
+    /// Number of sources
+    uint8_t sourceCount = 0;
+    /// Process noise per second
+    double processNoise;
+    /// Bias learning rate
+    double biasRate;
+    /// Current estimate
+    double estimate = 0.0;
+    /// Variance of the estimate
+    double covariance = 0.0;
+    /// Date of the last update
+    uint32_t lastUpdate = 0;
+    /// If the estimate exists
+    bool initialized = false;
+};
+
+}// namespace sbs::data
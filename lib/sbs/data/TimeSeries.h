@@ -0,0 +1,405 @@
+/**
+ * @file TimeSeries.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+/**
+ * @brief Namespace for data storage and processing
+ */
+namespace sbs::data {
+
+/**
+ * @brief Traits describing how a sample is stored in a column
+ * @tparam StorageType The type of the stored samples
+ *
+ * Floating point storages keep the value as is, integer storages keep a fixed-point
+ * representation defined by an offset and a resolution per channel.
+ */
+template<class StorageType>
+struct StorageTraits {
+    using accumulator_type           = double;///< Type used to sum samples
+    static constexpr bool fixedPoint = false; ///< If the storage is fixed-point
+};
+
+/**
+ * @brief Traits for 16 bits fixed-point storage
+ *
+ * The accumulator is large enough to sum a full column of 65535 samples.
+ */
+template<>
+struct StorageTraits<int16_t> {
+    using accumulator_type                = int32_t;///< Type used to sum samples
+    static constexpr bool fixedPoint      = true;   ///< If the storage is fixed-point
+    static constexpr int16_t lowestValue  = -32768; ///< Lowest storable value
+    static constexpr int16_t highestValue = 32767;  ///< Highest storable value
+};
+
+/**
+ * @brief Fixed-point format of a channel
+ *
+ * Physical value is `offset + raw * resolution`.
+ */
+struct ChannelFormat {
+    float offset     = 0.0F;///< Value for a raw sample of 0
+    float resolution = 1.0F;///< Value of one raw unit
+    /// Precomputed inverse of the resolution (avoid division on append)
+    float inverseResolution = 1.0F;
+};
+
+/**
+ * @brief Column-oriented ring buffer of timestamped samples
+ * @tparam StorageType Type of the stored samples (float or int16_t fixed-point)
+ * @tparam Channels Number of channels (columns)
+ * @tparam Capacity Maximum number of samples kept per channel
+ *
+ * Every channel is stored in its own contiguous array, so aggregations over one
+ * channel never touch the other ones. When full, appending overwrites the oldest sample.
+ * Index 0 always designates the oldest kept sample.
+ */
+template<class StorageType, uint8_t Channels, uint16_t Capacity>
+class TimeSeries {
+public:
+    static_assert(Channels > 0, "TimeSeries needs at least one channel");
+    static_assert(Capacity > 0, "TimeSeries needs a non-null capacity");
+    using traits           = StorageTraits<StorageType>;        ///< Storage traits
+    using accumulator_type = typename traits::accumulator_type;///< Accumulator type
+
+    /**
+     * @brief Read-only view on a contiguous range of samples of one channel
+     */
+    class Window {
+    public:
+        /**
+         * @brief Constructor
+         * @param series_ The time series
+         * @param channel_ The viewed channel
+         * @param first_ Index of the first sample (0 is the oldest)
+         * @param count_ Number of samples in the view
+         */
+        Window(const TimeSeries& series_, uint8_t channel_, uint16_t first_, uint16_t count_) :
+            series{series_}, channel{channel_}, first{first_}, count{count_} {}
+        /**
+         * @brief Number of samples in the view
+         * @return Number of samples
+         */
+        [[nodiscard]] uint16_t size() const { return count; }
+        /**
+         * @brief Check if the view is empty
+         * @return True if no sample in the view
+         */
+        [[nodiscard]] bool empty() const { return count == 0; }
+        /**
+         * @brief Access to a sample of the view
+         * @param index Index in the view
+         * @return The decoded value
+         */
+        [[nodiscard]] float operator[](uint16_t index) const { return series.value(channel, first + index); }
+        /**
+         * @brief Timestamp of a sample of the view
+         * @param index Index in the view
+         * @return The timestamp
+         */
+        [[nodiscard]] uint32_t timestamp(uint16_t index) const { return series.timestamp(first + index); }
+        /**
+         * @brief Sum of the view's values
+         * @return The sum
+         */
+        [[nodiscard]] float sum() const {
+            if constexpr (traits::fixedPoint) {
+                const ChannelFormat& fmt = series.formats[channel];
+                return fmt.offset * count + fmt.resolution * static_cast<float>(rawSum());
+            } else {
+                return static_cast<float>(rawSum());
+            }
+        }
+        /**
+         * @brief Mean of the view's values
+         * @return The mean (0 if empty)
+         */
+        [[nodiscard]] float mean() const {
+            if (count == 0) return 0.0F;
+            if constexpr (traits::fixedPoint) {
+                const ChannelFormat& fmt = series.formats[channel];
+                return fmt.offset + fmt.resolution * static_cast<float>(rawSum()) / static_cast<float>(count);
+            } else {
+                return static_cast<float>(rawSum() / static_cast<accumulator_type>(count));
+            }
+        }
+        /**
+         * @brief Minimum of the view's values
+         * @return The minimum (0 if empty)
+         */
+        [[nodiscard]] float min() const { return extremum(false); }
+        /**
+         * @brief Maximum of the view's values
+         * @return The maximum (0 if empty)
+         */
+        [[nodiscard]] float max() const { return extremum(true); }
+
+    private:
+        /// The viewed series
+        const TimeSeries& series;
+        /// The viewed channel
+        uint8_t channel;
+        /// Index of the first sample
+        uint16_t first;
+        /// Number of samples
+        uint16_t count;
+        /**
+         * @brief Sum of the raw values, walking the ring in at most two contiguous chunks
+         * @return The raw sum
+         */
+        [[nodiscard]] accumulator_type rawSum() const {
+            accumulator_type result = 0;
+            const StorageType* column = series.columns[channel];
+            uint16_t start            = series.physical(first);
+            uint16_t remaining        = count;
+            while (remaining > 0) {
+                uint16_t chunk = Capacity - start;
+                if (chunk > remaining) chunk = remaining;
+                for (uint16_t i = 0; i < chunk; ++i)
+                    result += column[start + i];
+                remaining -= chunk;
+                start = 0;
+            }
+            return result;
+        }
+        /**
+         * @brief Search extremum in the raw domain
+         * @param highest If the maximum is searched
+         * @return The decoded extremum
+         */
+        [[nodiscard]] float extremum(bool highest) const {
+            if (count == 0) return 0.0F;
+            const StorageType* column = series.columns[channel];
+            StorageType best          = column[series.physical(first)];
+            for (uint16_t i = 1; i < count; ++i) {
+                StorageType current = column[series.physical(first + i)];
+                if (highest ? (best < current) : (current < best))
+                    best = current;
+            }
+            return series.decode(channel, best);
+        }
+    };
+
+    /**
+     * @brief Define the fixed-point format of a channel
+     * @param channel The channel
+     * @param offset Value for raw 0
+     * @param resolution Value of one raw unit
+     *
+     * @note Only meaningful for integer storage; changing it invalidates already stored samples.
+     */
+    void setChannelFormat(uint8_t channel, float offset, float resolution) {
+        if (channel >= Channels || resolution == 0.0F) return;
+        formats[channel] = ChannelFormat{offset, resolution, 1.0F / resolution};
+    }
+
+    /**
+     * @brief Access to the fixed-point format of a channel
+     * @param channel The channel
+     * @return The format
+     */
+    [[nodiscard]] const ChannelFormat& getChannelFormat(uint8_t channel) const { return formats[channel]; }
+
+    /**
+     * @brief Add a new sample for all the channels
+     * @param time The sample's timestamp (must be non-decreasing)
+     * @param values Array of Channels values
+     */
+    void append(uint32_t time, const float* values) {
+        uint16_t slot = physical(count < Capacity ? count : 0);
+        for (uint8_t ch = 0; ch < Channels; ++ch)
+            columns[ch][slot] = encode(ch, values[ch]);
+        timestamps[slot] = time;
+        if (count < Capacity) {
+            ++count;
+        } else {
+            head = static_cast<uint16_t>((head + 1) % Capacity);
+        }
+    }
+
+    /**
+     * @brief Add a new sample for all the channels
+     * @tparam Values Value types (convertible to float)
+     * @param time The sample's timestamp (must be non-decreasing)
+     * @param values The Channels values
+     */
+    template<class... Values>
+    void append(uint32_t time, Values... values) {
+        static_assert(sizeof...(Values) == Channels, "One value per channel is required");
+        const float buffer[Channels] = {static_cast<float>(values)...};
+        append(time, buffer);
+    }
+
+    /**
+     * @brief Remove all samples
+     */
+    void clear() {
+        head  = 0;
+        count = 0;
+    }
+
+    /**
+     * @brief Number of kept samples
+     * @return Number of samples
+     */
+    [[nodiscard]] uint16_t size() const { return count; }
+
+    /**
+     * @brief Check for samples
+     * @return True if no samples
+     */
+    [[nodiscard]] bool empty() const { return count == 0; }
+
+    /**
+     * @brief Maximum number of kept samples
+     * @return The capacity
+     */
+    [[nodiscard]] static constexpr uint16_t capacity() { return Capacity; }
+
+    /**
+     * @brief Number of channels
+     * @return The number of channels
+     */
+    [[nodiscard]] static constexpr uint8_t channels() { return Channels; }
+
+    /**
+     * @brief Get the decoded value of a sample
+     * @param channel The channel
+     * @param index Sample index (0 is the oldest)
+     * @return The value
+     */
+    [[nodiscard]] float value(uint8_t channel, uint16_t index) const {
+        return decode(channel, columns[channel][physical(index)]);
+    }
+
+    /**
+     * @brief Get the timestamp of a sample
+     * @param index Sample index (0 is the oldest)
+     * @return The timestamp
+     */
+    [[nodiscard]] uint32_t timestamp(uint16_t index) const { return timestamps[physical(index)]; }
+
+    /**
+     * @brief Get a view on a range of samples
+     * @param channel The channel
+     * @param first The first sample index
+     * @param number The number of samples (truncated to available samples)
+     * @return The view
+     */
+    [[nodiscard]] Window window(uint8_t channel, uint16_t first, uint16_t number) const {
+        if (first > count) first = count;
+        if (number > count - first) number = count - first;
+        return Window{*this, channel, first, number};
+    }
+
+    /**
+     * @brief Get a view on all samples of a channel
+     * @param channel The channel
+     * @return The view
+     */
+    [[nodiscard]] Window all(uint8_t channel) const { return Window{*this, channel, 0, count}; }
+
+    /**
+     * @brief Get a view on the last samples of a channel
+     * @param channel The channel
+     * @param number The number of most recent samples
+     * @return The view
+     */
+    [[nodiscard]] Window last(uint8_t channel, uint16_t number) const {
+        if (number > count) number = count;
+        return Window{*this, channel, static_cast<uint16_t>(count - number), number};
+    }
+
+    /**
+     * @brief Get a view on the samples newer or equal to a timestamp
+     * @param channel The channel
+     * @param from The oldest timestamp to include
+     * @return The view
+     *
+     * Timestamps being sorted, the first sample is found by dichotomy.
+     */
+    [[nodiscard]] Window since(uint8_t channel, uint32_t from) const {
+        uint16_t low  = 0;
+        uint16_t high = count;
+        while (low < high) {
+            uint16_t mid = low + (high - low) / 2;
+            if (timestamp(mid) < from) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return Window{*this, channel, low, static_cast<uint16_t>(count - low)};
+    }
+
+private:
+    /// Sample storage, one contiguous array per channel
+    StorageType columns[Channels][Capacity] = {};
+    /// Sample timestamps
+    uint32_t timestamps[Capacity] = {};
+    /// Channel fixed-point formats
+    ChannelFormat formats[Channels] = {};
+    /// Physical index of the oldest sample
+    uint16_t head = 0;
+    /// Number of kept samples
+    uint16_t count = 0;
+
+    /**
+     * @brief Convert logical index to physical index in the ring
+     * @param index Logical index
+     * @return Physical index
+     */
+    [[nodiscard]] uint16_t physical(uint16_t index) const {
+        uint32_t pos = static_cast<uint32_t>(head) + index;
+        return static_cast<uint16_t>(pos >= Capacity ? pos - Capacity : pos);
+    }
+
+    /**
+     * @brief Convert value to storage
+     * @param channel The channel
+     * @param val The value
+     * @return The stored value
+     */
+    [[nodiscard]] StorageType encode(uint8_t channel, float val) const {
+        if constexpr (traits::fixedPoint) {
+            const ChannelFormat& fmt = formats[channel];
+            float raw                = (val - fmt.offset) * fmt.inverseResolution;
+            if (raw <= traits::lowestValue) return traits::lowestValue;
+            if (raw >= traits::highestValue) return traits::highestValue;
+            return static_cast<StorageType>(raw < 0.0F ? raw - 0.5F : raw + 0.5F);
+        } else {
+            (void) channel;
+            return static_cast<StorageType>(val);
+        }
+    }
+
+    /**
+     * @brief Convert storage to value
+     * @param channel The channel
+     * @param raw The stored value
+     * @return The value
+     */
+    [[nodiscard]] float decode(uint8_t channel, StorageType raw) const {
+        if constexpr (traits::fixedPoint) {
+            const ChannelFormat& fmt = formats[channel];
+            return fmt.offset + fmt.resolution * static_cast<float>(raw);
+        } else {
+            (void) channel;
+            return static_cast<float>(raw);
+        }
+    }
+};
+
+}// namespace sbs::data
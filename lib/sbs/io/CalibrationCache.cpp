@@ -0,0 +1,193 @@
+/**
+ * @file CalibrationCache.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "CalibrationCache.h"
+#include "core/Node.h"
+#include <string.h>
+#if defined(ESP8266)
+#include <LittleFS.h>
+#elif defined(ARDUINO_ARCH_AVR)
+#include <EEPROM.h>
+#elif defined(NATIVE)
+#include <cstdio>
+#endif
+
+namespace sbs::io::calibration {
+
+/**
+ * @brief One cached calibration blob
+ */
+struct Entry {
+    uint8_t address                    = 0; ///< Device's bus address
+    uint8_t chipId                     = 0; ///< Device's chip identifier
+    uint8_t size                       = 0; ///< Blob size, 0 for a free entry
+    uint8_t checksum                   = 0; ///< Blob checksum
+    uint8_t data[SBS_CALIBRATION_SIZE] = {};///< Blob content
+};
+
+/**
+ * @brief Persistent image of the cache
+ */
+struct Image {
+    uint32_t magic                       = 0; ///< Image magic number
+    Entry entries[SBS_CALIBRATION_SLOTS] = {};///< Cached entries
+    uint8_t next                         = 0; ///< Next entry to replace when full
+};
+
+/// Magic number of a valid image (version in the low byte)
+constexpr uint32_t imageMagic = 0x53424301;
+
+/// The RAM cache of each node
+static NodeLocal<Image> cache{Image{imageMagic, {}, 0}};
+/// If the cache is saved at each new blob, in each node
+static NodeLocal<bool> autoSaving{false};
+
+/**
+ * @brief Compute the checksum of a blob
+ * @param entry The entry
+ * @return The checksum
+ */
+static uint8_t checksum(const Entry& entry) {
+    uint8_t sum1 = entry.address ^ entry.chipId;
+    uint8_t sum2 = entry.size;
+    for (uint8_t i = 0; i < entry.size; ++i) {
+        sum1 = static_cast<uint8_t>(sum1 + entry.data[i]);
+        sum2 = static_cast<uint8_t>(sum2 + sum1);
+    }
+    return sum1 ^ sum2;
+}
+
+/**
+ * @brief Search an entry
+ * @param address Device's bus address
+ * @param chipId Device's chip identifier
+ * @return The entry or nullptr
+ */
+static Entry* find(uint8_t address, uint8_t chipId) {
+    for (auto& entry : cache->entries) {
+        if (entry.size != 0 && entry.address == address && entry.chipId == chipId)
+            return &entry;
+    }
+    return nullptr;
+}
+
+bool load(uint8_t address, uint8_t chipId, uint8_t size, uint8_t* blob) {
+    Entry* entry = find(address, chipId);
+    if (entry == nullptr || entry->size != size || entry->checksum != checksum(*entry))
+        return false;
+    memcpy(blob, entry->data, size);
+    return true;
+}
+
+void store(uint8_t address, uint8_t chipId, uint8_t size, const uint8_t* blob) {
+    if (size == 0 || size > SBS_CALIBRATION_SIZE)
+        return;
+    Image& image = cache.get();
+    Entry* entry = find(address, chipId);
+    if (entry == nullptr) {
+        for (auto& candidate : image.entries) {
+            if (candidate.size == 0) {
+                entry = &candidate;
+                break;
+            }
+        }
+    }
+    if (entry == nullptr) {
+        entry      = &image.entries[image.next];
+        image.next = static_cast<uint8_t>((image.next + 1) % SBS_CALIBRATION_SLOTS);
+    }
+    entry->address = address;
+    entry->chipId  = chipId;
+    entry->size    = size;
+    memcpy(entry->data, blob, size);
+    entry->checksum = checksum(*entry);
+    if (autoSaving.get())
+        save();
+}
+
+void invalidate(uint8_t address, uint8_t chipId) {
+    Entry* entry = find(address, chipId);
+    if (entry != nullptr)
+        entry->size = 0;
+}
+
+void clear() {
+    Image& image = cache.get();
+    for (auto& entry : image.entries)
+        entry.size = 0;
+    image.next = 0;
+}
+
+bool save() {
+#if defined(ESP8266)
+    if (!LittleFS.begin())
+        return false;
+    File file = LittleFS.open(SBS_CALIBRATION_FILE, "w");
+    if (!file)
+        return false;
+    size_t written = file.write(reinterpret_cast<const uint8_t*>(&cache.get()), sizeof(Image));
+    file.close();
+    return written == sizeof(Image);
+#elif defined(ARDUINO_ARCH_AVR)
+    // EEPROM.put only rewrites the changed bytes
+    EEPROM.put(SBS_CALIBRATION_EEPROM_OFFSET, cache.get());
+    return true;
+#elif defined(NATIVE)
+    FILE* file = fopen(SBS_CALIBRATION_FILE, "wb");
+    if (file == nullptr)
+        return false;
+    size_t written = fwrite(&cache.get(), sizeof(Image), 1, file);
+    fclose(file);
+    return written == 1;
+#else
+    return false;
+#endif
+}
+
+bool restore() {
+    Image image;
+#if defined(ESP8266)
+    if (!LittleFS.begin())
+        return false;
+    File file = LittleFS.open(SBS_CALIBRATION_FILE, "r");
+    if (!file)
+        return false;
+    size_t readSize = file.read(reinterpret_cast<uint8_t*>(&image), sizeof(Image));
+    file.close();
+    if (readSize != sizeof(Image))
+        return false;
+#elif defined(ARDUINO_ARCH_AVR)
+    EEPROM.get(SBS_CALIBRATION_EEPROM_OFFSET, image);
+#elif defined(NATIVE)
+    FILE* file = fopen(SBS_CALIBRATION_FILE, "rb");
+    if (file == nullptr)
+        return false;
+    size_t readSize = fread(&image, sizeof(Image), 1, file);
+    fclose(file);
+    if (readSize != 1)
+        return false;
+#else
+    return false;
+#endif
+    if (image.magic != imageMagic)
+        return false;
+    image.next = image.next % SBS_CALIBRATION_SLOTS;
+    // drop corrupted entries
+    for (auto& entry : image.entries) {
+        if (entry.size > SBS_CALIBRATION_SIZE || entry.checksum != checksum(entry))
+            entry.size = 0;
+    }
+    cache.get() = image;
+    return true;
+}
+
+void setAutoSave(bool autoSave) {
+    autoSaving.get() = autoSave;
+}
+
+}// namespace sbs::io::calibration
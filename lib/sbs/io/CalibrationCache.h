@@ -0,0 +1,114 @@
+/**
+ * @file CalibrationCache.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+/// Number of calibration blobs kept in RAM
+#ifndef SBS_CALIBRATION_SLOTS
+#define SBS_CALIBRATION_SLOTS 4
+#endif
+/// Maximum size of one calibration blob
+#ifndef SBS_CALIBRATION_SIZE
+#define SBS_CALIBRATION_SIZE 32
+#endif
+/// Offset of the cache in EEPROM (AVR targets)
+#ifndef SBS_CALIBRATION_EEPROM_OFFSET
+#define SBS_CALIBRATION_EEPROM_OFFSET 0
+#endif
+/// If the cache is restored at the system start, before the setup of the application (opt-in on native)
+#ifndef SBS_CALIBRATION_RESTORE
+#ifdef NATIVE
+#define SBS_CALIBRATION_RESTORE 0
+#else
+#define SBS_CALIBRATION_RESTORE 1
+#endif
+#endif
+/// File of the cache in the filesystem (ESP8266 and native targets)
+#ifndef SBS_CALIBRATION_FILE
+#ifdef NATIVE
+#define SBS_CALIBRATION_FILE "calibration.bin"
+#else
+#define SBS_CALIBRATION_FILE "/calibration.bin"
+#endif
+#endif
+
+/**
+ * @brief Cache of the sensors' factory calibration data
+ *
+ * Calibration blobs are the raw register contents, keyed by chip identity (bus address
+ * and chip id). The chip id is the one of the model: before using a blob, the drivers
+ * read its first bytes from the device, a replaced unit giving other trims.
+ *
+ * The RAM cache survives reconnections; it can be saved to and restored from the
+ * persistent storage of the target (LittleFS on ESP8266, EEPROM on AVR, a file on
+ * native) so that a rebooting node does not read the calibration over the bus again.
+ * The cache is restored at the system start (see SBS_CALIBRATION_RESTORE, off on native
+ * so that the tests do not depend on a file left in the working directory); it is saved
+ * by save(), or at each blob read from a device once setAutoSave is active (set it in
+ * the setup, before the sensors initialization).
+ * Each simulated node has its own RAM cache (see Node); the persistent storage is shared.
+ */
+namespace sbs::io::calibration {
+
+/**
+ * @brief Search a calibration blob in the cache
+ * @param address Device's bus address
+ * @param chipId Device's chip identifier
+ * @param size Expected blob size
+ * @param blob Output blob
+ * @return True if found (blob is untouched otherwise)
+ */
+bool load(uint8_t address, uint8_t chipId, uint8_t size, uint8_t* blob);
+
+/**
+ * @brief Add or replace a calibration blob in the cache
+ * @param address Device's bus address
+ * @param chipId Device's chip identifier
+ * @param size Blob size (ignored if bigger than SBS_CALIBRATION_SIZE)
+ * @param blob The blob
+ *
+ * If the cache is full, the oldest entry is replaced.
+ */
+void store(uint8_t address, uint8_t chipId, uint8_t size, const uint8_t* blob);
+
+/**
+ * @brief Remove a calibration blob from the cache
+ * @param address Device's bus address
+ * @param chipId Device's chip identifier
+ */
+void invalidate(uint8_t address, uint8_t chipId);
+
+/**
+ * @brief Empty the RAM cache
+ */
+void clear();
+
+/**
+ * @brief Write the RAM cache into the persistent storage
+ * @return True if written
+ */
+bool save();
+
+/**
+ * @brief Fill the RAM cache from the persistent storage
+ * @return True if a valid cache has been read
+ */
+bool restore();
+
+/**
+ * @brief Automatically save the cache at each new blob
+ * @param autoSave If auto save is active
+ */
+void setAutoSave(bool autoSave);
+
+}// namespace sbs::io::calibration
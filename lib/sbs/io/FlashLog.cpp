@@ -0,0 +1,367 @@
+/**
+ * @file FlashLog.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "FlashLog.h"
+#include "core/LogSink.h"
+#include <string.h>
+#if defined(ESP8266)
+#include <LittleFS.h>
+#elif defined(NATIVE)
+#include <cstdio>
+#endif
+
+namespace sbs::io::flashlog {
+
+/// Magic number of a ring file (version in the low byte)
+constexpr uint32_t fileMagic = 0x53424C02;
+/// Size of the file header: magic and generation
+constexpr uint16_t fileHeaderSize = 8;
+/// Size of the page header: generation and used size
+constexpr uint16_t pageHeaderSize = 6;
+/// Data capacity of a page
+constexpr uint16_t pageCapacity = SBS_FLASHLOG_PAGE_SIZE - pageHeaderSize;
+static_assert(SBS_FLASHLOG_FILE_SIZE >= fileHeaderSize + SBS_FLASHLOG_PAGE_SIZE, "Flash log files too small");
+static_assert(SBS_FLASHLOG_FILES > 1, "Flash log needs at least 2 files");
+
+/// If the ring is usable
+static bool ready = false;
+/// File being written
+static uint8_t current = 0;
+/// Generation of the file being written
+static uint32_t generation = 0;
+/// Size of the file being written
+static uint32_t fileUsed = 0;
+/// Page being filled (header and data)
+static uint8_t page[SBS_FLASHLOG_PAGE_SIZE];
+/// Data in the page being filled
+static uint16_t pageUsed = 0;
+
+/**
+ * @brief Build the path of a file
+ * @param path Output path
+ * @param index The file index
+ */
+static void filePath(char* path, uint8_t index) {
+    const size_t length = strlen(SBS_FLASHLOG_PREFIX);
+    memcpy(path, SBS_FLASHLOG_PREFIX, length);
+    path[length] = static_cast<char>('0' + index);
+    memcpy(path + length + 1, ".bin", 5);
+}
+
+/// Size of the path buffers
+constexpr size_t pathSize = sizeof(SBS_FLASHLOG_PREFIX) + 6;
+static_assert(SBS_FLASHLOG_FILES <= 10, "Flash log limited to 10 files");
+
+// The files are only appended to, or recreated empty: a copy-on-write filesystem
+// (LittleFS) never copies a block to rewrite a part of it.
+#if defined(ESP8266)
+static bool fsReady() { return LittleFS.begin(); }
+
+static bool readAt(uint8_t index, uint32_t offset, uint8_t* data, uint16_t size) {
+    char path[pathSize];
+    filePath(path, index);
+    File file = LittleFS.open(path, "r");
+    if (!file) return false;
+    bool done = file.seek(offset, SeekSet) && file.read(data, size) == size;
+    file.close();
+    return done;
+}
+
+static bool appendTo(uint8_t index, const uint8_t* data, uint16_t size) {
+    char path[pathSize];
+    filePath(path, index);
+    File file = LittleFS.open(path, "a");
+    if (!file) return false;
+    bool done = file.write(data, size) == size;
+    file.close();
+    return done;
+}
+
+static bool createFile(uint8_t index) {
+    char path[pathSize];
+    filePath(path, index);
+    File file = LittleFS.open(path, "w");
+    if (!file) return false;
+    file.close();
+    return true;
+}
+
+static uint32_t fileSize(uint8_t index) {
+    char path[pathSize];
+    filePath(path, index);
+    File file = LittleFS.open(path, "r");
+    if (!file) return 0;
+    const uint32_t result = file.size();
+    file.close();
+    return result;
+}
+#elif defined(NATIVE)
+static bool fsReady() { return true; }
+
+static bool readAt(uint8_t index, uint32_t offset, uint8_t* data, uint16_t size) {
+    char path[pathSize];
+    filePath(path, index);
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) return false;
+    bool done = fseek(file, static_cast<long>(offset), SEEK_SET) == 0 && fread(data, 1, size, file) == size;
+    fclose(file);
+    return done;
+}
+
+static bool appendTo(uint8_t index, const uint8_t* data, uint16_t size) {
+    char path[pathSize];
+    filePath(path, index);
+    FILE* file = fopen(path, "ab");
+    if (file == nullptr) return false;
+    bool done = fwrite(data, 1, size, file) == size;
+    fclose(file);
+    return done;
+}
+
+static bool createFile(uint8_t index) {
+    char path[pathSize];
+    filePath(path, index);
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) return false;
+    fclose(file);
+    return true;
+}
+
+static uint32_t fileSize(uint8_t index) {
+    char path[pathSize];
+    filePath(path, index);
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) return 0;
+    const long result = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : 0;
+    fclose(file);
+    return result > 0 ? static_cast<uint32_t>(result) : 0;
+}
+#else
+static bool fsReady() { return false; }
+static bool readAt(uint8_t, uint32_t, uint8_t*, uint16_t) { return false; }
+static bool appendTo(uint8_t, const uint8_t*, uint16_t) { return false; }
+static bool createFile(uint8_t) { return false; }
+static uint32_t fileSize(uint8_t) { return 0; }
+#endif
+
+/**
+ * @brief Recreate a file with only its header
+ * @param index The file index
+ * @param fileGeneration The file generation
+ * @return False if the write failed
+ */
+static bool writeHeader(uint8_t index, uint32_t fileGeneration) {
+    uint8_t header[fileHeaderSize];
+    memcpy(header, &fileMagic, 4);
+    memcpy(header + 4, &fileGeneration, 4);
+    return createFile(index) && appendTo(index, header, fileHeaderSize);
+}
+
+/**
+ * @brief Read a file header
+ * @param index The file index
+ * @param fileGeneration Output: the file generation
+ * @return False if the file is missing or invalid
+ */
+static bool readHeader(uint8_t index, uint32_t& fileGeneration) {
+    uint8_t header[fileHeaderSize];
+    if (!readAt(index, 0, header, fileHeaderSize)) return false;
+    uint32_t magic;
+    memcpy(&magic, header, 4);
+    memcpy(&fileGeneration, header + 4, 4);
+    return magic == fileMagic;
+}
+
+/**
+ * @brief Read a written page
+ * @param index The file index
+ * @param offset Offset of the page in the file
+ * @param fileGeneration Generation of the file
+ * @param data Output: the page
+ * @return Data size in the page, 0 at the end of the file (or of its valid part)
+ */
+static uint16_t readPage(uint8_t index, uint32_t offset, uint32_t fileGeneration, uint8_t* data) {
+    if (!readAt(index, offset, data, pageHeaderSize)) return 0;
+    uint32_t pageGeneration;
+    uint16_t used;
+    memcpy(&pageGeneration, data, 4);
+    memcpy(&used, data + 4, 2);
+    if (pageGeneration != fileGeneration || used == 0 || used > pageCapacity) return 0;
+    // a page cut by a reset is not read
+    if (!readAt(index, offset + pageHeaderSize, data + pageHeaderSize, used)) return 0;
+    return used;
+}
+
+/**
+ * @brief Start the next file, reusing the oldest one
+ */
+static void nextFile() {
+    current  = static_cast<uint8_t>((current + 1) % SBS_FLASHLOG_FILES);
+    fileUsed = fileHeaderSize;
+    writeHeader(current, ++generation);
+}
+
+/**
+ * @brief Write the data of the page at the end of the current file, then empty the page
+ * @return False if the write failed
+ */
+static bool writePage() {
+    const uint16_t size = pageHeaderSize + pageUsed;
+    if (fileUsed + size > SBS_FLASHLOG_FILE_SIZE) nextFile();
+    memcpy(page, &generation, 4);
+    memcpy(page + 4, &pageUsed, 2);
+    pageUsed = 0;
+    fileUsed += size;
+    return appendTo(current, page, size);
+}
+
+bool format() {
+    ready = false;
+    if (!fsReady()) return false;
+    for (uint8_t i = 0; i < SBS_FLASHLOG_FILES; ++i) {
+        if (!writeHeader(i, i == 0 ? 1 : 0))
+            return false;
+    }
+    current    = 0;
+    generation = 1;
+    fileUsed   = fileHeaderSize;
+    pageUsed   = 0;
+    ready      = true;
+    return true;
+}
+
+bool begin() {
+    ready = false;
+    if (!fsReady()) return false;
+    bool found = false;
+    for (uint8_t i = 0; i < SBS_FLASHLOG_FILES; ++i) {
+        uint32_t fileGeneration;
+        if (!readHeader(i, fileGeneration))
+            return format();
+        if (!found || fileGeneration > generation) {
+            found      = true;
+            current    = i;
+            generation = fileGeneration;
+        }
+    }
+    // search the end of the written pages
+    pageUsed = 0;
+    fileUsed = fileHeaderSize;
+    while (const uint16_t used = readPage(current, fileUsed, generation, page))
+        fileUsed += pageHeaderSize + used;
+    ready = true;
+    // the appends go after the end of the file: a cut page is left in the previous file
+    if (fileUsed != fileSize(current))
+        nextFile();
+    return true;
+}
+
+void append(const uint8_t* data, uint16_t size) {
+    if (!ready) return;
+    while (size > 0) {
+        uint16_t chunk = pageCapacity - pageUsed;
+        if (chunk > size) chunk = size;
+        memcpy(page + pageHeaderSize + pageUsed, data, chunk);
+        pageUsed += chunk;
+        data += chunk;
+        size -= chunk;
+        if (pageUsed == pageCapacity)
+            writePage();
+    }
+}
+
+bool sync() {
+    if (!ready || pageUsed == 0) return true;
+    return writePage();
+}
+
+void read(Consumer consumer) {
+    if (!ready) return;
+    // files from the oldest to the current one
+    uint8_t scratch[SBS_FLASHLOG_PAGE_SIZE];
+    for (uint8_t offset = 1; offset <= SBS_FLASHLOG_FILES; ++offset) {
+        const auto index = static_cast<uint8_t>((current + offset) % SBS_FLASHLOG_FILES);
+        uint32_t fileGeneration;
+        if (!readHeader(index, fileGeneration) || fileGeneration == 0) continue;
+        uint32_t position = fileHeaderSize;
+        while (const uint16_t used = readPage(index, position, fileGeneration, scratch)) {
+            consumer(scratch + pageHeaderSize, used);
+            position += pageHeaderSize + used;
+        }
+    }
+    // then the data not yet written
+    if (pageUsed != 0)
+        consumer(page + pageHeaderSize, pageUsed);
+}
+
+/// Sink receiving the dump
+static Sink* dumpTarget = nullptr;
+
+/**
+ * @brief Give one page to the dump's sink
+ * @param data The page data
+ * @param size The data size
+ */
+static void dumpPage(const uint8_t* data, uint16_t size) {
+    dumpTarget->write(data, size);
+    dumpTarget->flush();
+}
+
+void dump(Sink& target) {
+    flushLog();
+    dumpTarget = &target;
+    read(&dumpPage);
+    dumpTarget = nullptr;
+}
+
+void dump() {
+    dump(serialSink());
+}
+
+/// Amount of data counted by size()
+static uint32_t counted = 0;
+
+/**
+ * @brief Count the data
+ * @param size The data size
+ */
+static void count(const uint8_t*, uint16_t size) {
+    counted += size;
+}
+
+uint32_t size() {
+    counted = 0;
+    read(&count);
+    return counted;
+}
+
+/**
+ * @brief Sink writing the log into the ring
+ */
+class FlashSink : public Sink {
+public:
+    void write(const uint8_t* data, uint16_t size) override { append(data, size); }
+    void flush() override { sync(); }
+};
+
+/// The ring's sink
+static FlashSink flashSink;
+
+Sink& sink() {
+    return flashSink;
+}
+
+void attach(bool active) {
+    if (active) {
+        addSink(flashSink);
+    } else {
+        removeSink(flashSink);
+    }
+}
+
+}// namespace sbs::io::flashlog
@@ -0,0 +1,113 @@
+/**
+ * @file FlashLog.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/LogSink.h"
+
+/// Number of files of the ring
+#ifndef SBS_FLASHLOG_FILES
+#define SBS_FLASHLOG_FILES 4
+#endif
+/// Size of each file in bytes
+#ifndef SBS_FLASHLOG_FILE_SIZE
+#define SBS_FLASHLOG_FILE_SIZE 16384
+#endif
+/// Largest write in bytes
+#ifndef SBS_FLASHLOG_PAGE_SIZE
+#define SBS_FLASHLOG_PAGE_SIZE 256
+#endif
+/// Path of the files, without index and extension
+#ifndef SBS_FLASHLOG_PREFIX
+#ifdef NATIVE
+#define SBS_FLASHLOG_PREFIX "flashlog"
+#else
+#define SBS_FLASHLOG_PREFIX "/log"
+#endif
+#endif
+
+/**
+ * @brief Persistent log ring in the filesystem
+ *
+ * The log is kept in a set of files used in turn: when a file is full, the oldest one is
+ * recreated empty and reused, so the writes are spread over the whole set. Data is
+ * appended one page at a time (a full page, or the incomplete one at a sync), never
+ * rewritten in place: LittleFS copies a whole block to rewrite a part of it. Each page
+ * carries its size and the generation of its file: a page cut by a reset is not read back.
+ *
+ * Available on ESP8266 (LittleFS) and native (plain files); a no-op on the other targets.
+ */
+namespace sbs::io::flashlog {
+
+/**
+ * @brief Function receiving the content of the log
+ */
+using Consumer = void (*)(const uint8_t* data, uint16_t size);
+
+/**
+ * @brief Open the ring, creating the files if needed, and find the write position
+ * @return False if the filesystem is not usable
+ */
+bool begin();
+
+/**
+ * @brief Erase the whole ring (recreate empty files)
+ * @return False if the filesystem is not usable
+ */
+bool format();
+
+/**
+ * @brief Add data to the log
+ * @param data The data
+ * @param size The data size
+ *
+ * Data is kept in RAM until a page is full.
+ */
+void append(const uint8_t* data, uint16_t size);
+
+/**
+ * @brief Write the data kept in RAM (as a short page)
+ * @return False if the write failed
+ */
+bool sync();
+
+/**
+ * @brief Read the whole log, oldest data first
+ * @param consumer Function receiving the data, one page at a time
+ */
+void read(Consumer consumer);
+
+/**
+ * @brief Give the whole log to a sink, oldest first
+ * @param target The sink (flushed after each page)
+ */
+void dump(Sink& target);
+
+/**
+ * @brief Write the whole log to the serial line (or the standard output), oldest first
+ */
+void dump();
+
+/**
+ * @brief Amount of data in the log
+ * @return Stored bytes, including the incomplete page
+ */
+[[nodiscard]] uint32_t size();
+
+/**
+ * @brief Access to the sink writing into the ring (e.g. to define its level)
+ * @return The sink
+ */
+[[nodiscard]] Sink& sink();
+
+/**
+ * @brief Record the log output: register or unregister the ring's sink
+ * @param active If the log output is recorded
+ */
+void attach(bool active);
+
+}// namespace sbs::io::flashlog
@@ -6,6 +6,7 @@
  * All modification must get authorization from the author.
  */
 #include "utils.h"
+#include "core/Node.h"
 #include "math/base.h"
 #ifdef ARDUINO_ARCH_AVR
 #else
@@ -55,17 +56,17 @@ private:
     /// buffer size
     uint8_t size = 0;
 };
-/// instance of the i2c emulation
-static emulatedWire EmulatedWire{};
+/// instance of the i2c emulation, one per node
+static NodeLocal<emulatedWire> EmulatedWire;
 
 void setEmulatedMode(bool emulated_){
-    EmulatedWire.actived = emulated_;
+    EmulatedWire->actived = emulated_;
 }
 
 void setEmulatedBuffer(uint8_t size, uint8_t* buffer){
-    if (!EmulatedWire.actived)
+    if (!EmulatedWire->actived)
         return;
-    EmulatedWire.setBuffer(size,buffer);
+    EmulatedWire->setBuffer(size,buffer);
 }
 
 /**
@@ -73,8 +74,8 @@ void setEmulatedBuffer(uint8_t size, uint8_t* buffer){
  * @return Read byte
  */
 uint32_t _read() {
-    if (EmulatedWire.actived){
-        return EmulatedWire.read();
+    if (EmulatedWire->actived){
+        return EmulatedWire->read();
     }
 #ifdef ARDUINO
     return static_cast<uint32_t>(Wire.read());
@@ -108,7 +109,7 @@ void writeCommand([[maybe_unused]] uint8_t address, [[maybe_unused]] uint8_t reg
 
 [[nodiscard]] uint8_t read8(uint8_t address, uint8_t reg) {
     _write(address, reg);
-    //if (EmulatedWire.actived){
+    //if (EmulatedWire->actived){
     //    std::cout << "Request byte @ " << std::hex << static_cast<int>(reg) << "\n";
     //}
 #ifdef ARDUINO
@@ -125,7 +126,7 @@ void writeCommand([[maybe_unused]] uint8_t address, [[maybe_unused]] uint8_t reg
 
 
 void read(uint8_t address, uint8_t reg, uint8_t size_, uint8_t* output, bool lowFirst) {
-    //if (EmulatedWire.actived){
+    //if (EmulatedWire->actived){
     //    std::cout << "Request " << std::dec << static_cast<int>(size_) << " bytes @ " << std::hex << static_cast<int>(reg) << "\n";
     //}
     _write(address, reg);
@@ -0,0 +1,380 @@
+/**
+ * @file filters.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "core/Executor.h"
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#include <type_traits>
+#endif
+
+namespace sbs::math {
+
+#ifdef ARDUINO_ARCH_AVR
+/**
+ * @brief Unsigned integer type of the same size (std::make_unsigned, missing on AVR)
+ * @tparam Type The integer type
+ */
+template<class Type>
+struct UnsignedTraits;
+/// 8 bits integers
+template<>
+struct UnsignedTraits<int8_t> {
+    using type = uint8_t;///< Unsigned type
+};
+/// 16 bits integers
+template<>
+struct UnsignedTraits<int16_t> {
+    using type = uint16_t;///< Unsigned type
+};
+/// 32 bits integers
+template<>
+struct UnsignedTraits<int32_t> {
+    using type = uint32_t;///< Unsigned type
+};
+/// 64 bits integers
+template<>
+struct UnsignedTraits<int64_t> {
+    using type = uint64_t;///< Unsigned type
+};
+#else
+/**
+ * @brief Unsigned integer type of the same size
+ * @tparam Type The integer type
+ */
+template<class Type>
+struct UnsignedTraits {
+    using type = std::make_unsigned_t<Type>;///< Unsigned type
+};
+#endif
+
+/**
+ * @brief Exponential moving average
+ * @tparam Type Sample type (floating point)
+ *
+ * `value = value + alpha * (sample - value)`, the first sample initializes the filter.
+ */
+template<class Type>
+class Ema {
+public:
+    /**
+     * @brief Constructor
+     * @param alpha_ Smoothing factor in ]0, 1] (1 means no smoothing)
+     */
+    explicit Ema(Type alpha_) :
+        alpha{alpha_} {}
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     * @return The filtered value
+     */
+    const Type& push(const Type& sample) {
+        if (primed) {
+            current += alpha * (sample - current);
+        } else {
+            current = sample;
+            primed  = true;
+        }
+        return current;
+    }
+    /**
+     * @brief Forget the history
+     */
+    void reset() { primed = false; }
+    /**
+     * @brief Check if the filter got at least one sample
+     * @return True if initialized
+     */
+    [[nodiscard]] bool ready() const { return primed; }
+    /**
+     * @brief Get the filtered value
+     * @return The filtered value
+     */
+    [[nodiscard]] const Type& value() const { return current; }
+    /**
+     * @brief Get the smoothing factor
+     * @return The smoothing factor
+     */
+    [[nodiscard]] const Type& getAlpha() const { return alpha; }
+    /**
+     * @brief Define the smoothing factor
+     * @param alpha_ The new smoothing factor
+     */
+    void setAlpha(const Type& alpha_) { alpha = alpha_; }
+
+private:
+    /// Smoothing factor
+    Type alpha;
+    /// Filtered value
+    Type current{};
+    /// If initialized
+    bool primed = false;
+};
+
+/**
+ * @brief Median of the last N samples
+ * @tparam Type Sample type (must have operator < defined)
+ * @tparam Size Window size (odd values give a true median)
+ *
+ * Keeps the slots of the window insertion-sorted by value: each sample costs at most Size
+ * moves, which for the small windows used against spikes is cheaper than any heap
+ * structure. The outgoing sample is found by its slot, not by its value, so a sample that
+ * compares with nothing (NaN) still leaves the window.
+ */
+template<class Type, uint8_t Size>
+class MedianFilter {
+public:
+    static_assert(Size > 0, "Median window must not be empty");
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     * @return The median of the current window
+     */
+    const Type& push(const Type& sample) {
+        uint8_t pos = count;
+        if (count == Size) {
+            // remove the slot of the oldest sample from the sorted slots
+            pos = 0;
+            while (order[pos] != next) ++pos;
+            for (; pos + 1 < count; ++pos) order[pos] = order[pos + 1];
+            pos = count - 1;
+        } else {
+            ++count;
+        }
+        // insert the new sample
+        history[next] = sample;
+        while (pos > 0 && sample < history[order[pos - 1]]) {
+            order[pos] = order[pos - 1];
+            --pos;
+        }
+        order[pos] = next;
+        next       = static_cast<uint8_t>((next + 1) % Size);
+        return value();
+    }
+    /**
+     * @brief Forget all samples
+     */
+    void reset() {
+        count = 0;
+        next  = 0;
+    }
+    /**
+     * @brief Number of samples in the window
+     * @return The number of samples
+     */
+    [[nodiscard]] uint8_t size() const { return count; }
+    /**
+     * @brief Get the median of the window
+     * @return The median (lower median for even counts)
+     */
+    [[nodiscard]] const Type& value() const { return history[order[count > 0 ? (count - 1) / 2 : 0]]; }
+
+private:
+    /// Samples in arrival order (ring)
+    Type history[Size] = {};
+    /// Slots of the samples in ascending order of the samples
+    uint8_t order[Size] = {};
+    /// Number of samples
+    uint8_t count = 0;
+    /// Next slot in history
+    uint8_t next = 0;
+};
+
+/**
+ * @brief Boxcar decimator: mean of each block of Factor samples
+ * @tparam Type Sample type
+ * @tparam Factor Decimation factor
+ * @tparam Accumulator Accumulation type (large enough to hold Factor samples)
+ */
+template<class Type, uint16_t Factor, class Accumulator = Type>
+class BoxcarDecimator {
+public:
+    static_assert(Factor > 0, "Decimation factor must not be null");
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     * @return True if a new output is available
+     */
+    bool push(const Type& sample) {
+        accumulator += static_cast<Accumulator>(sample);
+        if (++count < Factor) return false;
+        output      = static_cast<Type>(accumulator / static_cast<Accumulator>(Factor));
+        accumulator = Accumulator{};
+        count       = 0;
+        return true;
+    }
+    /**
+     * @brief Forget the current block
+     */
+    void reset() {
+        accumulator = Accumulator{};
+        count       = 0;
+    }
+    /**
+     * @brief Get the last output
+     * @return The last output
+     */
+    [[nodiscard]] const Type& value() const { return output; }
+
+private:
+    /// Running sum of the block
+    Accumulator accumulator{};
+    /// Last output
+    Type output{};
+    /// Samples in the current block
+    uint16_t count = 0;
+};
+
+/**
+ * @brief Cascaded integrator-comb decimator
+ * @tparam Order Number of integrator and comb stages
+ * @tparam Factor Decimation factor (differential delay is 1)
+ * @tparam Accumulator Integer accumulation type
+ *
+ * Integer only: the stages run in the unsigned type of the accumulator, the integrators
+ * wrap modulo its size and the combs remove the wrap, as long as the accumulator holds `input bits + Order * log2(Factor)` bits.
+ * The output is normalized by the filter gain `Factor^Order`.
+ */
+template<uint8_t Order, uint16_t Factor, class Accumulator = int32_t>
+class CicDecimator {
+public:
+    static_assert(Order > 0, "CIC order must not be null");
+    static_assert(Factor > 0, "Decimation factor must not be null");
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     * @return True if a new output is available
+     */
+    bool push(Accumulator sample) {
+        // the wrap is defined for the unsigned types only
+        integrators[0] += static_cast<Stage>(sample);
+        for (uint8_t i = 1; i < Order; ++i)
+            integrators[i] += integrators[i - 1];
+        if (++count < Factor) return false;
+        count     = 0;
+        Stage val = integrators[Order - 1];
+        for (uint8_t i = 0; i < Order; ++i) {
+            const Stage tmp = val - combs[i];
+            combs[i]        = val;
+            val             = tmp;
+        }
+        output = static_cast<Accumulator>(val) / gain();
+        return true;
+    }
+    /**
+     * @brief Reset the filter state
+     */
+    void reset() {
+        for (uint8_t i = 0; i < Order; ++i) {
+            integrators[i] = 0;
+            combs[i]       = 0;
+        }
+        count  = 0;
+        output = 0;
+    }
+    /**
+     * @brief Get the last output
+     * @return The last output
+     */
+    [[nodiscard]] Accumulator value() const { return output; }
+    /**
+     * @brief Get the filter's DC gain
+     * @return The gain
+     */
+    static constexpr Accumulator gain() {
+        Accumulator result = 1;
+        for (uint8_t i = 0; i < Order; ++i) result *= Factor;
+        return result;
+    }
+
+private:
+    /// Type of the stages
+    using Stage = typename UnsignedTraits<Accumulator>::type;
+    /// Integrator stages
+    Stage integrators[Order] = {};
+    /// Comb stages delay line
+    Stage combs[Order] = {};
+    /// Last output
+    Accumulator output = 0;
+    /// Samples since the last output
+    uint16_t count = 0;
+};
+
+// ----------------- BATCHES ------------------------
+// The batch functions run in parallel on native (see sbs::parallelFor), to reprocess
+// recorded series.
+
+/**
+ * @brief Filter independent channels, the channels in parallel
+ * @tparam Filter Filter type, whose push gives the filtered value (Ema, MedianFilter)
+ * @tparam Type Sample type
+ * @param filters One filter per channel, keeping its state between calls
+ * @param input Samples, channel after channel (length samples each)
+ * @param output Filtered samples, same layout (may be the input)
+ * @param channels Number of channels
+ * @param length Number of samples of each channel
+ */
+template<class Filter, class Type>
+void filterChannels(Filter* filters, const Type* input, Type* output, size_t channels, size_t length) {
+    const size_t grain = length < SBS_BATCH_GRAIN ? SBS_BATCH_GRAIN / (length + 1) + 1 : 1;
+    parallelFor(0, channels, grain, [=](size_t first, size_t last) {
+        for (size_t channel = first; channel < last; ++channel) {
+            const size_t offset = channel * length;
+            for (size_t i = 0; i < length; ++i)
+                output[offset + i] = filters[channel].push(input[offset + i]);
+        }
+    });
+}
+
+/**
+ * @brief Median filter of a series, by parts in parallel
+ * @tparam Type Sample type (must have operator < defined)
+ * @tparam Size Window size
+ * @param input The samples
+ * @param output Filtered samples (must not be the input)
+ * @param count Number of samples
+ *
+ * Each part first feeds the Size - 1 samples before it to its own filter: the output is
+ * the one of a single MedianFilter fed from the first sample.
+ */
+template<class Type, uint8_t Size>
+void medianFilter(const Type* input, Type* output, size_t count) {
+    parallelFor(0, count, SBS_BATCH_GRAIN, [=](size_t first, size_t last) {
+        MedianFilter<Type, Size> filter;
+        for (size_t i = first > Size - 1U ? first - (Size - 1U) : 0; i < first; ++i)
+            filter.push(input[i]);
+        for (size_t i = first; i < last; ++i)
+            output[i] = filter.push(input[i]);
+    });
+}
+
+/**
+ * @brief Boxcar decimation of a series, by blocks in parallel
+ * @tparam Type Sample type
+ * @tparam Factor Decimation factor
+ * @tparam Accumulator Accumulation type (large enough to hold Factor samples)
+ * @param input The samples
+ * @param output The means of the blocks (must not be the input)
+ * @param count Number of samples
+ * @return Number of outputs (an incomplete last block is dropped)
+ */
+template<class Type, uint16_t Factor, class Accumulator = Type>
+size_t boxcarDecimate(const Type* input, Type* output, size_t count) {
+    const size_t outputs = count / Factor;
+    parallelFor(0, outputs, SBS_BATCH_GRAIN / Factor + 1, [=](size_t first, size_t last) {
+        BoxcarDecimator<Type, Factor, Accumulator> decimator;
+        for (size_t i = first * Factor; i < last * Factor; ++i) {
+            if (decimator.push(input[i])) output[i / Factor] = decimator.value();
+        }
+    });
+    return outputs;
+}
+
+}// namespace sbs::math
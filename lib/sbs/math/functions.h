@@ -75,4 +75,19 @@ constexpr inline BaseType exp(const BaseType& value) {
 #endif
 }
 
+/**
+ * @brief Square root
+ * @tparam BaseType Value and return type
+ * @param value Value to compute
+ * @return Square root of value
+ */
+template<class BaseType>
+constexpr inline BaseType sqrt(const BaseType& value) {
+#ifdef ARDUINO_ARCH_AVR
+    return ::sqrt(value);
+#else
+    return std::sqrt(value);
+#endif
+}
+
 }// namespace sbs::math
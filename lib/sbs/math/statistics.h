@@ -0,0 +1,146 @@
+/**
+ * @file statistics.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "base.h"
+#include "functions.h"
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+namespace sbs::math {
+
+/**
+ * @brief Streaming minimum and maximum
+ * @tparam Type Sample type (must have operator < defined)
+ */
+template<class Type>
+class MinMax {
+public:
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     */
+    void push(const Type& sample) {
+        if (count == 0) {
+            lowest  = sample;
+            highest = sample;
+        } else {
+            lowest  = math::min(lowest, sample);
+            highest = math::max(highest, sample);
+        }
+        ++count;
+    }
+    /**
+     * @brief Forget all samples
+     */
+    void reset() { count = 0; }
+    /**
+     * @brief Number of samples
+     * @return The number of samples
+     */
+    [[nodiscard]] uint32_t size() const { return count; }
+    /**
+     * @brief Lowest sample
+     * @return The minimum (undefined if no samples)
+     */
+    [[nodiscard]] const Type& min() const { return lowest; }
+    /**
+     * @brief Highest sample
+     * @return The maximum (undefined if no samples)
+     */
+    [[nodiscard]] const Type& max() const { return highest; }
+
+private:
+    /// Number of samples
+    uint32_t count = 0;
+    /// Lowest sample
+    Type lowest{};
+    /// Highest sample
+    Type highest{};
+};
+
+/**
+ * @brief Streaming mean and variance using Welford's algorithm
+ * @tparam Type Sample type (floating point)
+ *
+ * Numerically stable, one division per sample, no sample storage.
+ */
+template<class Type>
+class RunningStats {
+public:
+    /**
+     * @brief Add a sample
+     * @param sample The sample
+     */
+    void push(const Type& sample) {
+        ++count;
+        extremes.push(sample);
+        Type delta = sample - average;
+        average += delta / static_cast<Type>(count);
+        squares += delta * (sample - average);
+    }
+    /**
+     * @brief Forget all samples
+     */
+    void reset() {
+        count   = 0;
+        average = Type{};
+        squares = Type{};
+        extremes.reset();
+    }
+    /**
+     * @brief Number of samples
+     * @return The number of samples
+     */
+    [[nodiscard]] uint32_t size() const { return count; }
+    /**
+     * @brief Mean of samples
+     * @return The mean
+     */
+    [[nodiscard]] Type mean() const { return average; }
+    /**
+     * @brief Unbiased (sample) variance
+     * @return The variance (0 if less than 2 samples)
+     */
+    [[nodiscard]] Type variance() const { return count > 1 ? squares / static_cast<Type>(count - 1) : Type{}; }
+    /**
+     * @brief Population variance
+     * @return The variance (0 if no samples)
+     */
+    [[nodiscard]] Type populationVariance() const { return count > 0 ? squares / static_cast<Type>(count) : Type{}; }
+    /**
+     * @brief Unbiased standard deviation
+     * @return The standard deviation
+     */
+    [[nodiscard]] Type stddev() const { return math::sqrt(variance()); }
+    /**
+     * @brief Lowest sample
+     * @return The minimum
+     */
+    [[nodiscard]] Type min() const { return extremes.min(); }
+    /**
+     * @brief Highest sample
+     * @return The maximum
+     */
+    [[nodiscard]] Type max() const { return extremes.max(); }
+
+private:
+    /// Number of samples
+    uint32_t count = 0;
+    /// Running mean
+    Type average{};
+    /// Running sum of squared differences from the mean
+    Type squares{};
+    /// Extreme values
+    MinMax<Type> extremes;
+};
+
+}// namespace sbs::math
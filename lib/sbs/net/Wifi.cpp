@@ -7,6 +7,9 @@
  */
 
 #include "Wifi.h"
+#include "core/EventLoop.h"
+#include "core/Node.h"
+#include "time/timing.h"
 #if defined(ARDUINO_SAMD_MKRWIFI1010)
 #include <WiFiNINA.h>
 #elif defined(ESP8266)
@@ -66,7 +69,7 @@ struct FakeWiFi {
      * @brief Get the device status code
      * @return Device's status code
      */
-    [[nodiscard]] uint8_t status() const { return internalStatus; }
+    [[nodiscard]] uint8_t status() { return internalStatus.get(); }
     /**
      * @brief Get the mac address of the device
      * @param mac The mac address of the device
@@ -79,21 +82,44 @@ struct FakeWiFi {
      * @return The mac address of the hotspot
      */
     uint8_t* BSSID(uint8_t* mac) { return mac; }
-    /// Just the internal status
-    uint8_t internalStatus = WL_NO_SHIELD;
+    /// Just the internal status, one per node
+    sbs::NodeLocal<uint8_t> internalStatus{WL_NO_SHIELD};
 };
 /// Fake Wifi
 static FakeWiFi WiFi;
 
 #ifdef NATIVE
 void fakeWifiSetStatus(uint8_t st){
-    WiFi.internalStatus = st;
+    WiFi.internalStatus.get() = st;
 }
 #endif
 #endif
 
 namespace sbs::net {
 
+/**
+ * @brief State of the network event source
+ */
+struct NetworkPoll {
+    uint32_t lastCheck      = 0;                        ///< Time of the last check
+    Wifi::Status lastStatus = Wifi::Status::Unavailable;///< Status at the last check
+};
+
+/// The network event source state of each node
+static NodeLocal<NetworkPoll> networkPoll;
+
+/**
+ * @brief Event source of the network: an event at each change of status
+ */
+static void networkSource() {
+    NetworkPoll& poll = networkPoll.get();
+    if (time::elapsedMillis(poll.lastCheck) < SBS_WIFI_POLL_PERIOD) return;
+    poll.lastCheck    = time::millis();
+    const auto status = Wifi::get().getStatus();
+    if (status != poll.lastStatus) events().post(SystemEvent::Network, static_cast<uint16_t>(status));
+    poll.lastStatus = status;
+}
+
 Wifi::Status Wifi::getStatus() const {
     if (WiFi.status() == WL_CONNECTED)
         return Status::ClientConnected;
@@ -107,6 +133,7 @@ void Wifi::init(const string& ssid, const string& pass) const {
     WiFi.mode(WIFI_STA);
 #endif
     WiFi.begin(ssid.c_str(), pass.c_str());
+    events().addSource(&networkSource);
 }
 
 [[nodiscard]] string Wifi::getSSID() const {
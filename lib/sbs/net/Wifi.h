@@ -10,6 +10,11 @@
 #include "Address.h"
 #include "core/string.h"
 
+/// Time between two checks of the network status by the event source in milliseconds
+#ifndef SBS_WIFI_POLL_PERIOD
+#define SBS_WIFI_POLL_PERIOD 500
+#endif
+
 namespace sbs::net {
 /**
  * @brief Class Wifi
@@ -32,6 +37,8 @@ public:
      * @brief Initialize the device and try to connect to the given ssid with the pass phrase
      * @param ssid SSID to connect
      * @param pass Pass phrase to use.
+     *
+     * The changes of status are then posted as SystemEvent::Network events.
      */
     void init(const string& ssid, const string& pass) const;
     /**
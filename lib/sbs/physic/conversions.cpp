@@ -6,6 +6,8 @@
  * All modification must get authorization from the author.
  */
 #include "constants.h"
+#include "conversions.h"
+#include "core/Executor.h"
 #include "math/functions.h"
 
 namespace sbs::physic {
@@ -43,4 +45,32 @@ double computeDewPoint(double measuredTemperature, double measuredRelativeHumidi
     return b_high * alpha / (a_high - alpha);
 }
 
+void celsiusToKelvin(const double* temperatures, double* output, size_t count) {
+    parallelFor(0, count, SBS_BATCH_GRAIN, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i)
+            output[i] = celsiusToKelvin(temperatures[i]);
+    });
+}
+
+void getAltitude(double qnh, const double* measuredPressures, const double* measuredTemperatures, double* output, size_t count) {
+    parallelFor(0, count, SBS_BATCH_GRAIN, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i)
+            output[i] = getAltitude(qnh, measuredPressures[i], measuredTemperatures[i]);
+    });
+}
+
+void computeQnh(double sensorAltitude, const double* measuredPressures, const double* measuredTemperatures, double* output, size_t count) {
+    parallelFor(0, count, SBS_BATCH_GRAIN, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i)
+            output[i] = computeQnh(sensorAltitude, measuredPressures[i], measuredTemperatures[i]);
+    });
+}
+
+void computeDewPoint(const double* measuredTemperatures, const double* measuredRelativeHumidities, double* output, size_t count) {
+    parallelFor(0, count, SBS_BATCH_GRAIN, [=](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i)
+            output[i] = computeDewPoint(measuredTemperatures[i], measuredRelativeHumidities[i]);
+    });
+}
+
 }// namespace sbs::physic
@@ -7,6 +7,11 @@
  */
 
 #pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stddef.h>
+#else
+#include <cstddef>
+#endif
 
 /**
  * @brief Namespace for physics functions
@@ -46,4 +51,45 @@ double computeQnh(double sensorAltitude, double measuredPressure, double measure
  */
 double computeDewPoint(double measuredTemperature, double measuredRelativeHumidity);
 
+// ----------------- BATCHES ------------------------
+// The batch versions handle the samples in parallel on native (see sbs::parallelFor), by
+// parts of SBS_BATCH_GRAIN samples. The output may be one of the inputs.
+
+/**
+ * @brief Convert celsius temperatures to kelvin
+ * @param temperatures Temperatures in celsius
+ * @param output Temperatures in kelvin
+ * @param count Number of samples
+ */
+void celsiusToKelvin(const double* temperatures, double* output, size_t count);
+
+/**
+ * @brief Compute altitudes based on a QNH value
+ * @param qnh Mean sea level corrected pressure
+ * @param measuredPressures Sensor measured pressures
+ * @param measuredTemperatures Sensor measured temperatures
+ * @param output Altitudes of the sensor above MSL
+ * @param count Number of samples
+ */
+void getAltitude(double qnh, const double* measuredPressures, const double* measuredTemperatures, double* output, size_t count);
+
+/**
+ * @brief Compute mean sea level corrected pressures based on precise sensor altitude
+ * @param sensorAltitude Sensor known altitude
+ * @param measuredPressures Sensor measured pressures
+ * @param measuredTemperatures Sensor measured temperatures
+ * @param output The MSL-corrected pressures
+ * @param count Number of samples
+ */
+void computeQnh(double sensorAltitude, const double* measuredPressures, const double* measuredTemperatures, double* output, size_t count);
+
+/**
+ * @brief Compute dew points
+ * @param measuredTemperatures Sensor measured temperatures
+ * @param measuredRelativeHumidities Sensor measured relative humidities
+ * @param output Dew point temperatures
+ * @param count Number of samples
+ */
+void computeDewPoint(const double* measuredTemperatures, const double* measuredRelativeHumidities, double* output, size_t count);
+
 }// namespace sbs::physic
@@ -19,6 +19,11 @@ void setup();
 
 /**
  * @brief Function called in an infinite loop
+ *
+ * The posted events (see events()) are dispatched before each call, the timers (see
+ * time::timers) and the tasks registered in the scheduler (see time::scheduler) run after
+ * it. To sleep when nothing is due, the application registers time::idleSleep as the idle
+ * hook of the scheduler (time::scheduler().setIdleHook) in its setup.
  */
 void loop();
 
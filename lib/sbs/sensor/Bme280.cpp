@@ -7,10 +7,12 @@
  */
 
 #include "Bme280.h"
+#include "io/CalibrationCache.h"
 #include "io/i2c/utils.h"
 #include "math/base.h"
 #include "physic/conversions.h"
 #include "time/timing.h"
+#include <string.h>
 
 namespace sbs::sensor {
 constexpr uint8_t defaultAddress    = 0x76;   ///< Default BME280 i2C address
@@ -20,25 +22,34 @@ constexpr uint8_t doubleByteShift   = 16U;    ///< 16 bits shift
 constexpr static uint8_t chipId     = 0x60;   ///< chip Id
 constexpr static uint8_t resetCode  = 0x56;   ///< code for device reset
 constexpr static uint8_t statusMask = 0b1001U;///< Status mask
+constexpr static uint8_t calTPHSize = 25U;    ///< Size of the temperature, pressure and H1 calibration block
+constexpr static uint8_t calHSize   = 7U;     ///< Size of the humidity calibration block
 
 BME280::BME280() :
     io::i2c::Device{defaultAddress} {
 }
 
 const BME280::SensorData& BME280::getValue() {
+    while (!measure())
+        // the wait advances the virtual clock, and yields on the boards
+        time::delay(measurement.remainingDelay() != 0 ? measurement.remainingDelay() : 1);
+    return data;
+}
+
+bool BME280::measure() {
+    SBS_CO_BEGIN(measurement);
     if (!presence()) {
         init();
     }
     if (presence()) {
         if (setting.mode == Setting::WorkingMode::Forced) {// device need to be waked up
             io::i2c::writeCommand(getAddress(), R_CTRL_MEAS, setting.toCtrlMeasReg());
-            time::delay(setting.maxMeasurementTime());
+            SBS_CO_DELAY(measurement, setting.maxMeasurementTime());
         }
-        while (io::i2c::read8(getAddress(), R_STATUS & statusMask) != 0)
-            ;
+        SBS_CO_WAIT_UNTIL(measurement, io::i2c::read8(getAddress(), R_STATUS & statusMask) == 0);
         readAndCompensate();
     }
-    return data;
+    SBS_CO_END(measurement);
 }
 
 void BME280::init() {
@@ -62,10 +73,21 @@ void BME280::applySetting() {
 }
 
 void BME280::readCalibration() {
-    uint8_t dataTPH1[25];
-    uint8_t dataH[7];
-    io::i2c::read(getAddress(), R_T1_LSB, 25U, dataTPH1, true);
-    io::i2c::read(getAddress(), R_H2_LSB, 7U, dataH, true);
+    uint8_t raw[calTPHSize + calHSize];
+    uint8_t* dataTPH1 = raw;
+    uint8_t* dataH    = raw + calTPHSize;
+    bool cached = io::calibration::load(getAddress(), chipId, sizeof(raw), raw);
+    if (cached) {
+        // the cache is keyed by model: T1 tells another unit of the same model
+        uint8_t signature[2];
+        io::i2c::read(getAddress(), R_T1_LSB, sizeof(signature), signature, true);
+        cached = memcmp(raw, signature, sizeof(signature)) == 0;
+    }
+    if (!cached) {
+        io::i2c::read(getAddress(), R_T1_LSB, calTPHSize, dataTPH1, true);
+        io::i2c::read(getAddress(), R_H2_LSB, calHSize, dataH, true);
+        io::calibration::store(getAddress(), chipId, sizeof(raw), raw);
+    }
     auto temp  = static_cast<uint16_t>(dataTPH1[0]) | static_cast<uint16_t>(dataTPH1[1]) << byteShift;
     cal.T1     = static_cast<double>(temp) * 16.0;
     auto temps = static_cast<int16_t>(static_cast<uint16_t>(dataTPH1[2]) | static_cast<uint16_t>(dataTPH1[3]) << byteShift);
@@ -116,7 +138,7 @@ void BME280::readAndCompensate() {
     double var1        = (rawT - cal.T1);
     double var2        = var1 * var1 * cal.T3;
     auto fine       = static_cast<int32_t>(var1 * cal.T2 + var2);
-    data.temperature   = (var1 * cal.T2 + var2) / 5120.0;
+    data.temperature   = getCorrection(Channel::Temperature).apply((var1 * cal.T2 + var2) / 5120.0);
 
     // Pressure Compensation
     const uint32_t rawP  = ((static_cast<uint32_t>(rawData[0]) << doubleByteShift) | (static_cast<uint32_t>(rawData[1]) << byteShift) | static_cast<uint32_t>(rawData[2])) >> semiByteShift;
@@ -128,7 +150,7 @@ void BME280::readAndCompensate() {
         data.pressure = 0.0;//---UNCOVER---
     } else {
         data.pressure = -(rawP + var2) / var1;
-        data.pressure = cal.P9 * data.pressure * data.pressure + cal.P8 * data.pressure + cal.P7;
+        data.pressure = getCorrection(Channel::Pressure).apply(cal.P9 * data.pressure * data.pressure + cal.P8 * data.pressure + cal.P7);
     }
 
     // Humidity Compensation
@@ -138,7 +160,7 @@ void BME280::readAndCompensate() {
     var2                = cal.H2/65536.0 * (1.0 + cal.H6 / 67108864.0 * var1 * (1.0 + cal.H3 / 67108864.0 * var1));
     var1                = (rawH - (cal.H4 * 64.0 + cal.H5 / 16384.0 * var1)) * var2;
     var1 *= (1.0 - cal.H1 * var1 / 524288.0);
-    data.humidity = math::clamp(var1, 0.0, 100.0);
+    data.humidity = math::clamp(getCorrection(Channel::Humidity).apply(var1), 0.0, 100.0);
 }
 
 double BME280::SensorData::getAltitude(double qnh) const {
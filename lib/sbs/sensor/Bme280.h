@@ -6,6 +6,8 @@
  * All modification must get authorization from the author.
  */
 #pragma once
+#include "Correction.h"
+#include "core/Coroutine.h"
 #include "io/i2c/Device.h"
 
 /**
@@ -323,6 +325,21 @@ public:
      */
     [[nodiscard]] const SensorData& getValue();
 
+    /**
+     * @brief Measure without blocking (coroutine: call until it returns true)
+     * @return True when the measure is done, the values are then available with getData
+     *
+     * Gives the hand back while the device measures, so the measure can run in a
+     * scheduler task.
+     */
+    bool measure();
+
+    /**
+     * @brief Get the last measured values
+     * @return The last measure
+     */
+    [[nodiscard]] const SensorData& getData() const { return data; }
+
     /**
      * @brief Init device
      */
@@ -370,12 +387,47 @@ public:
         applySetting();
     }
 
+    /**
+     * @brief Measurement channels
+     */
+    enum struct Channel {
+        Temperature,///< Temperature channel
+        Humidity,   ///< Humidity channel
+        Pressure,   ///< Pressure channel
+    };
+
+    /**
+     * @brief Define the user correction of a channel
+     * @param channel The channel
+     * @param correction The correction
+     *
+     * Corrections are applied after the compensation; the internal fine temperature
+     * used by the pressure and humidity compensations stays uncorrected.
+     */
+    void setCorrection(const Channel& channel, const ChannelCorrection& correction) {
+        corrections[static_cast<uint8_t>(channel)] = correction;
+    }
+
+    /**
+     * @brief Get the user correction of a channel
+     * @param channel The channel
+     * @return The correction
+     */
+    [[nodiscard]] const ChannelCorrection& getCorrection(const Channel& channel) const {
+        return corrections[static_cast<uint8_t>(channel)];
+    }
+
 private:
     /// Device Settings
     Setting setting = Setting::getPredefined(Setting::PredefinedSettings::WeatherMonitor);
 
     /// Sensor Data
     SensorData data = SensorData{};
+    /// Measure sequence
+    Coroutine measurement;
+
+    /// User corrections by channel
+    ChannelCorrection corrections[3];
 
     /**
      * @brief Write setting into the registers.
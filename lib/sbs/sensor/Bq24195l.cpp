@@ -43,7 +43,24 @@ bool Bq24195l::checkPresence() const {
 }
 
 void Bq24195l::setChargingMode(const ChargingMode& mode) {
-    if (!presence()) return;
+    while (!applyChargingMode(mode))
+        // the wait advances the virtual clock, and yields on the boards
+        time::delay(modeChange.remainingDelay() != 0 ? modeChange.remainingDelay() : 1);
+}
+
+bool Bq24195l::applyChargingMode(const ChargingMode& mode) {
+    SBS_CO_BEGIN(modeChange);
+    if (presence() && selectChargingMode(mode)) {
+        ApplySettings();
+        if (mode == ChargingMode::OTG) {
+            // wait for enable boost mode
+            SBS_CO_DELAY(modeChange, 500);
+        }
+    }
+    SBS_CO_END(modeChange);
+}
+
+bool Bq24195l::selectChargingMode(const ChargingMode& mode) {
     switch (mode) {
     case ChargingMode::Disconnected:
         settings.batFetDisable = true;
@@ -69,14 +86,11 @@ void Bq24195l::setChargingMode(const ChargingMode& mode) {
         // Enable Battery Fault interrupt and disable Charge Fault Interrupt
         settings.interruptMode = Settings::InterruptMode::BatFaultOnly;
         settings.batFetDisable = false;
-        // wait for enable boost mode
         break;
     default:
-        return;
+        return false;
     }
-    ApplySettings();
-    if (mode==ChargingMode::OTG)
-        time::delay(500);
+    return true;
 }
 
 uint8_t Bq24195l::getVersion() const {
@@ -6,6 +6,7 @@
  * All modification must get authorization from the author.
  */
 #pragma once
+#include "core/Coroutine.h"
 #include "io/i2c/Device.h"
 #include "math/base.h"
 
@@ -445,6 +446,16 @@ public:
      */
     void setChargingMode(const ChargingMode& mode);
 
+    /**
+     * @brief Define the charging mode without blocking (coroutine: call until it returns true)
+     * @param mode The new mode (same value at each call)
+     * @return True when the mode is applied
+     *
+     * Gives the hand back while the boost mode starts (OTG mode), so the change can run
+     * in a scheduler task.
+     */
+    bool applyChargingMode(const ChargingMode& mode);
+
     // System Status Register
     /**
      * @brief Status of the input
@@ -563,6 +574,15 @@ public:
 private:
     /// Setting, initialize as Constructor default
     Settings settings = Settings{};
+    /// Charging mode change sequence
+    Coroutine modeChange;
+
+    /**
+     * @brief Define the settings of a charging mode
+     * @param mode The mode
+     * @return False if the mode is unknown
+     */
+    bool selectChargingMode(const ChargingMode& mode);
 
     enum Registers {
         /**
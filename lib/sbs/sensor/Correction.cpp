@@ -0,0 +1,71 @@
+/**
+ * @file Correction.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Correction.h"
+
+namespace sbs::sensor {
+
+void ChannelCorrection::setLinear(double gain_, double offset_) {
+    gain       = gain_;
+    offset     = offset_;
+    pointCount = 0;
+}
+
+bool ChannelCorrection::setTable(const Point* points, uint8_t count) {
+    if (points == nullptr || count < 2 || count > maxPoints)
+        return false;
+    for (uint8_t i = 1; i < count; ++i) {
+        if (!(points[i - 1].measured < points[i].measured))
+            return false;
+    }
+    setLinear(1.0, 0.0);
+    // segment i covers [abscissa[i], abscissa[i+1]]
+    for (uint8_t i = 0; i + 1 < count; ++i) {
+        abscissa[i]  = points[i].measured;
+        slope[i]     = (points[i + 1].actual - points[i].actual) / (points[i + 1].measured - points[i].measured);
+        intercept[i] = points[i].actual - slope[i] * points[i].measured;
+    }
+    abscissa[count - 1] = points[count - 1].measured;
+    pointCount          = count;
+    return true;
+}
+
+double ChannelCorrection::apply(double value) const {
+    if (pointCount == 0)
+        return gain * value + offset;
+    // search the segment by dichotomy, last segment is extended above the table
+    uint8_t low  = 0;
+    uint8_t high = pointCount - 2;
+    while (low < high) {
+        uint8_t mid = (low + high + 1) / 2;
+        if (value < abscissa[mid]) {
+            high = mid - 1;
+        } else {
+            low = mid;
+        }
+    }
+    return slope[low] * value + intercept[low];
+}
+
+bool ChannelCorrection::calibrate(double measured1, double reference1, double measured2, double reference2) {
+    if (measured1 == measured2 || pointCount != 0)
+        return false;
+    double fitGain   = (reference2 - reference1) / (measured2 - measured1);
+    double fitOffset = reference1 - fitGain * measured1;
+    setLinear(fitGain * gain, fitGain * offset + fitOffset);
+    return true;
+}
+
+bool ChannelCorrection::calibrate(double measured, double reference) {
+    if (pointCount != 0)
+        return false;
+    setLinear(gain, offset + reference - measured);
+    return true;
+}
+
+}// namespace sbs::sensor
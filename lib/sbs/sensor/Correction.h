@@ -0,0 +1,226 @@
+/**
+ * @file Correction.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+/// Maximum number of points of a correction table (the tables are in the RAM of each channel)
+#ifndef SBS_CORRECTION_POINTS
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_CORRECTION_POINTS 3
+#else
+#define SBS_CORRECTION_POINTS 6
+#endif
+#endif
+
+namespace sbs::sensor {
+
+/**
+ * @brief User correction of one measurement channel
+ *
+ * Either a linear correction `gain * value + offset`, or a piecewise-linear table
+ * (outside the table, the first or last segment is extended). All the per-sample
+ * coefficients are precomputed when the correction is defined: applying it costs one
+ * multiply-add (plus a segment search for tables). Drivers with a linear conversion fold
+ * the correction into their own coefficients, so it costs nothing at all.
+ */
+class ChannelCorrection {
+public:
+    /// Maximum number of points in a table
+    static constexpr uint8_t maxPoints = SBS_CORRECTION_POINTS;
+    static_assert(maxPoints >= 2, "Correction tables need at least 2 points");
+
+    /**
+     * @brief Point of a correction table
+     */
+    struct Point {
+        double measured;///< Uncorrected value
+        double actual;  ///< Corrected value
+    };
+
+    /**
+     * @brief Linear coefficients: `scale * value + bias`
+     */
+    struct Linear {
+        double scale = 1.0;///< Multiplier
+        double bias  = 0.0;///< Addend
+    };
+
+    /**
+     * @brief Default constructor: identity.
+     */
+    ChannelCorrection() = default;
+
+    /**
+     * @brief Linear correction constructor
+     * @param gain_ The gain
+     * @param offset_ The offset
+     */
+    ChannelCorrection(double gain_, double offset_) { setLinear(gain_, offset_); }
+
+    /**
+     * @brief Define a linear correction (remove any table)
+     * @param gain_ The gain
+     * @param offset_ The offset
+     */
+    void setLinear(double gain_, double offset_);
+
+    /**
+     * @brief Define a piecewise-linear correction
+     * @param points The table points, sorted by increasing measured value
+     * @param count Number of points (2 to maxPoints)
+     * @return False if the table is invalid (correction unchanged)
+     */
+    bool setTable(const Point* points, uint8_t count);
+
+    /**
+     * @brief Reset to identity
+     */
+    void reset() { setLinear(1.0, 0.0); }
+
+    /**
+     * @brief Check if the correction is the identity
+     * @return True if no correction
+     */
+    [[nodiscard]] bool isIdentity() const { return pointCount == 0 && gain == 1.0 && offset == 0.0; }
+
+    /**
+     * @brief Check if the correction is a table
+     * @return True if piecewise-linear
+     */
+    [[nodiscard]] bool isTable() const { return pointCount != 0; }
+
+    /**
+     * @brief Get the linear gain
+     * @return The gain (1 for tables)
+     */
+    [[nodiscard]] double getGain() const { return gain; }
+
+    /**
+     * @brief Get the linear offset
+     * @return The offset (0 for tables)
+     */
+    [[nodiscard]] double getOffset() const { return offset; }
+
+    /**
+     * @brief Correct a value
+     * @param value The uncorrected value
+     * @return The corrected value
+     */
+    [[nodiscard]] double apply(double value) const;
+
+    /**
+     * @brief Fold the correction after a linear conversion
+     * @param scale The conversion multiplier
+     * @param bias The conversion addend
+     * @return Coefficients of `correction(scale * raw + bias)` (linear correction only)
+     */
+    [[nodiscard]] Linear fold(double scale, double bias) const { return {gain * scale, gain * bias + offset}; }
+
+    /**
+     * @brief Two-point calibration
+     * @param measured1 Value given by the sensor at the first point (with current correction)
+     * @param reference1 Actual value at the first point
+     * @param measured2 Value given by the sensor at the second point (with current correction)
+     * @param reference2 Actual value at the second point
+     * @return False if the points are degenerate or a table is defined (correction unchanged)
+     *
+     * The new correction is composed with the current one, so the sensor does not need
+     * to be reset to raw output before calibrating.
+     */
+    bool calibrate(double measured1, double reference1, double measured2, double reference2);
+
+    /**
+     * @brief One-point calibration (offset only)
+     * @param measured Value given by the sensor (with current correction)
+     * @param reference Actual value
+     * @return False if a table is defined (correction unchanged)
+     */
+    bool calibrate(double measured, double reference);
+
+private:
+    /// Linear gain
+    double gain = 1.0;
+    /// Linear offset
+    double offset = 0.0;
+    /// Table abscissas
+    double abscissa[maxPoints] = {};
+    /// Precomputed slope of each segment
+    double slope[maxPoints - 1] = {};
+    /// Precomputed intercept of each segment
+    double intercept[maxPoints - 1] = {};
+    /// Number of table points (0 for linear)
+    uint8_t pointCount = 0;
+};
+
+/**
+ * @brief Linear conversion of a raw channel followed by its user correction
+ *
+ * Keeps the conversion folded with the correction so that converting a sample is a
+ * single multiply-add, whatever the linear correction.
+ */
+class CorrectedChannel {
+public:
+    /**
+     * @brief Constructor
+     * @param scale Conversion multiplier
+     * @param bias Conversion addend
+     */
+    CorrectedChannel(double scale, double bias) :
+        conversion{scale, bias}, folded{scale, bias} {}
+
+    /**
+     * @brief Redefine the conversion (e.g. after reading sensor calibration)
+     * @param scale Conversion multiplier
+     * @param bias Conversion addend
+     */
+    void setConversion(double scale, double bias) {
+        conversion = {scale, bias};
+        folded     = correction.fold(scale, bias);
+    }
+
+    /**
+     * @brief Define the user correction
+     * @param correction_ The correction
+     */
+    void setCorrection(const ChannelCorrection& correction_) {
+        correction = correction_;
+        folded     = correction.fold(conversion.scale, conversion.bias);
+    }
+
+    /**
+     * @brief Get the user correction
+     * @return The correction
+     */
+    [[nodiscard]] const ChannelCorrection& getCorrection() const { return correction; }
+
+    /**
+     * @brief Convert a raw sample
+     * @param raw The raw sample
+     * @return The corrected value
+     */
+    [[nodiscard]] double convert(double raw) const {
+        if (correction.isTable())
+            return correction.apply(conversion.scale * raw + conversion.bias);
+        return folded.scale * raw + folded.bias;
+    }
+
+private:
+    /// Sensor conversion
+    ChannelCorrection::Linear conversion;
+    /// Conversion folded with the correction
+    ChannelCorrection::Linear folded;
+    /// User correction
+    ChannelCorrection correction;
+};
+
+}// namespace sbs::sensor
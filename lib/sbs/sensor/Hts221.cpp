@@ -7,13 +7,17 @@
  */
 
 #include "Hts221.h"
+#include "io/CalibrationCache.h"
 #include "io/i2c/utils.h"
 #include "physic/conversions.h"
+#include <string.h>
 
 namespace sbs::sensor {
 constexpr uint8_t defaultAddress = 0x5F;///< Default HTS221 i2C address
 constexpr uint8_t chipId         = 0xBC;///< chip Id
-constexpr uint8_t byteShift       = 8U;  ///< 8 bits shift
+constexpr uint8_t byteShift      = 8U;  ///< 8 bits shift
+constexpr uint8_t calSize        = 16U; ///< Size of the calibration block
+constexpr uint8_t autoIncrement  = 0x80;///< Register flag for multiple bytes read
 
 Hts221::Hts221() :
     io::i2c::Device{defaultAddress} {
@@ -57,36 +61,62 @@ bool Hts221::checkPresence() const {
 }
 
 void Hts221::readCalibration() {
-    uint8_t h0rH = io::i2c::read8(getAddress(), Registers::R_H0_rH_x2_REG);
-    uint8_t h1rH = io::i2c::read8(getAddress(), Registers::R_H1_rH_x2_REG);
+    uint8_t raw[calSize];
+    bool cached = io::calibration::load(getAddress(), chipId, calSize, raw);
+    if (cached) {
+        // the cache is keyed by model: H0_rH_x2 and H1_rH_x2 tell another unit of the same model
+        uint8_t signature[2];
+        io::i2c::read(getAddress(), Registers::R_H0_rH_x2_REG | autoIncrement, sizeof(signature), signature, true);
+        cached = memcmp(raw, signature, sizeof(signature)) == 0;
+    }
+    if (!cached) {
+        io::i2c::read(getAddress(), Registers::R_H0_rH_x2_REG | autoIncrement, calSize, raw, true);
+        io::calibration::store(getAddress(), chipId, calSize, raw);
+    }
+    // calibration byte of the given register
+    auto at = [&raw](uint8_t reg) -> uint16_t { return raw[reg - Registers::R_H0_rH_x2_REG]; };
+    uint8_t h0rH = at(Registers::R_H0_rH_x2_REG);
+    uint8_t h1rH = at(Registers::R_H1_rH_x2_REG);
 
-    auto t0degC = static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T0_degC_x8_REG) | (static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T1_T0_MSB_REG) & 0x03) << byteShift));
-    auto t1degC = static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T1_degC_x8_REG) | (static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T1_T0_MSB_REG) & 0x0c) << 6));
+    auto t0degC = static_cast<uint16_t>(at(Registers::R_T0_degC_x8_REG) | ((at(Registers::R_T1_T0_MSB_REG) & 0x03) << byteShift));
+    auto t1degC = static_cast<uint16_t>(at(Registers::R_T1_degC_x8_REG) | ((at(Registers::R_T1_T0_MSB_REG) & 0x0c) << 6));
 
-    auto h0t0Out = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_H0_T0_OUT_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_H0_T0_OUT_REG + 1)) << byteShift);
-    auto h1t0Out = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_H1_T0_OUT_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_H1_T0_OUT_REG + 1)) << byteShift);
+    auto h0t0Out = static_cast<int16_t>(at(Registers::R_H0_T0_OUT_REG) | at(Registers::R_H0_T0_OUT_REG + 1) << byteShift);
+    auto h1t0Out = static_cast<int16_t>(at(Registers::R_H1_T0_OUT_REG) | at(Registers::R_H1_T0_OUT_REG + 1) << byteShift);
 
-    auto t0Out = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_T0_OUT_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T0_OUT_REG + 1)) << byteShift);
-    auto t1Out = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_T1_OUT_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_T1_OUT_REG + 1)) << byteShift);
+    auto t0Out = static_cast<int16_t>(at(Registers::R_T0_OUT_REG) | at(Registers::R_T0_OUT_REG + 1) << byteShift);
+    auto t1Out = static_cast<int16_t>(at(Registers::R_T1_OUT_REG) | at(Registers::R_T1_OUT_REG + 1) << byteShift);
 
     // calculate slopes and 0 offset from calibration values,
     // for future calculations: value = a * X + b
 
-    cal.H_Slope = (h1rH - h0rH) / (2.0 * (h1t0Out - h0t0Out));
-    cal.H_Zero  = (h0rH / 2.0) - cal.H_Slope * h0t0Out;
+    double hSlope = (h1rH - h0rH) / (2.0 * (h1t0Out - h0t0Out));
+    humidityChannel.setConversion(hSlope, (h0rH / 2.0) - hSlope * h0t0Out);
 
-    cal.T_Slope = (t1degC - t0degC) / (8.0 * (t1Out - t0Out));
-    cal.T_Zero  = (t0degC / 8.0) - cal.T_Slope * t0Out;
+    double tSlope = (t1degC - t0degC) / (8.0 * (t1Out - t0Out));
+    temperatureChannel.setConversion(tSlope, (t0degC / 8.0) - tSlope * t0Out);
 }
 
 void Hts221::readAndCompensate() {
     // read value and convert
     auto tout     = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_TEMP_OUT_L_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_TEMP_OUT_L_REG + 1)) << byteShift);
-    data.temperature = tout * cal.T_Slope + cal.T_Zero;
+    data.temperature = temperatureChannel.convert(tout);
 
     // read value and convert
     auto hout  = static_cast<int16_t>(io::i2c::read8(getAddress(), Registers::R_HUMIDITY_OUT_L_REG) | static_cast<uint16_t>(io::i2c::read8(getAddress(), Registers::R_HUMIDITY_OUT_L_REG + 1)) << byteShift);
-    data.humidity = hout * cal.H_Slope + cal.H_Zero;
+    data.humidity = humidityChannel.convert(hout);
+}
+
+void Hts221::setCorrection(const Channel& channel, const ChannelCorrection& correction) {
+    if (channel == Channel::Temperature) {
+        temperatureChannel.setCorrection(correction);
+    } else {
+        humidityChannel.setCorrection(correction);
+    }
+}
+
+const ChannelCorrection& Hts221::getCorrection(const Channel& channel) const {
+    return channel == Channel::Temperature ? temperatureChannel.getCorrection() : humidityChannel.getCorrection();
 }
 
 
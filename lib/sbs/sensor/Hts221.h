@@ -7,6 +7,7 @@
  */
 
 #pragma once
+#include "Correction.h"
 #include "io/i2c/Device.h"
 
 namespace sbs::sensor {
@@ -151,6 +152,28 @@ public:
         data = SensorData{};
     }
 
+    /**
+     * @brief Measurement channels
+     */
+    enum struct Channel {
+        Temperature,///< Temperature channel
+        Humidity,   ///< Humidity channel
+    };
+
+    /**
+     * @brief Define the user correction of a channel
+     * @param channel The channel
+     * @param correction The correction
+     */
+    void setCorrection(const Channel& channel, const ChannelCorrection& correction);
+
+    /**
+     * @brief Get the user correction of a channel
+     * @param channel The channel
+     * @return The correction
+     */
+    [[nodiscard]] const ChannelCorrection& getCorrection(const Channel& channel) const;
+
 private:
     /// Sensor Data
     SensorData data = SensorData{};
@@ -177,17 +200,10 @@ private:
         R_T1_OUT_REG         = 0x3e,///< Calibration register
     };
 
-    /**
-     * @brief Sensor Calibration constants for compensation computation
-     */
-    struct CalibrationDataDbl {
-        double T_Zero  = 0;
-        double T_Slope = 0;
-        double H_Zero  = 0;
-        double H_Slope = 0;
-    };
-
-    CalibrationDataDbl cal = CalibrationDataDbl{};///< storage of calibration data
+    /// Temperature conversion (from calibration data) and correction
+    CorrectedChannel temperatureChannel{0.0, 0.0};
+    /// Humidity conversion (from calibration data) and correction
+    CorrectedChannel humidityChannel{0.0, 0.0};
 
     /**
      * \brief read & store calibration data
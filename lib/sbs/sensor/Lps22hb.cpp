@@ -47,9 +47,21 @@ void Lps22hb::readAndCompensate() {
     for (uint8_t hum = 0; hum < 5; ++hum)
         rawData[hum] = io::i2c::read8(getAddress(), Registers::R_PRESS_OUT_XL + hum);
     uint32_t rawT    = rawData[3] | rawData[4] << byteShift;
-    data.temperature = rawT / 100.0;
+    data.temperature = temperatureChannel.convert(rawT);
     uint32_t rawP    = static_cast<uint32_t>(rawData[0]) | static_cast<uint32_t>(rawData[1]) << byteShift | static_cast<uint32_t>(rawData[2]) << doubleByteShift;
-    data.pressure    = rawP / 4096.0 - pressureOffset;
+    data.pressure    = pressureChannel.convert(rawP);
+}
+
+void Lps22hb::setCorrection(const Channel& channel, const ChannelCorrection& correction) {
+    if (channel == Channel::Temperature) {
+        temperatureChannel.setCorrection(correction);
+    } else {
+        pressureChannel.setCorrection(correction);
+    }
+}
+
+const ChannelCorrection& Lps22hb::getCorrection(const Channel& channel) const {
+    return channel == Channel::Temperature ? temperatureChannel.getCorrection() : pressureChannel.getCorrection();
 }
 
 double Lps22hb::SensorData::getAltitude(double qnh) const {
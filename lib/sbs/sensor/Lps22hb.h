@@ -6,6 +6,7 @@
  * All modification must get authorization from the author.
  */
 #pragma once
+#include "Correction.h"
 #include "io/i2c/Device.h"
 
 namespace sbs::sensor {
@@ -158,21 +159,47 @@ public:
         data = SensorData{};
     }
 
+    /**
+     * @brief Measurement channels
+     */
+    enum struct Channel {
+        Temperature,///< Temperature channel
+        Pressure,   ///< Pressure channel
+    };
+
+    /**
+     * @brief Define the user correction of a channel
+     * @param channel The channel
+     * @param correction The correction
+     */
+    void setCorrection(const Channel& channel, const ChannelCorrection& correction);
+
+    /**
+     * @brief Get the user correction of a channel
+     * @param channel The channel
+     * @return The correction
+     */
+    [[nodiscard]] const ChannelCorrection& getCorrection(const Channel& channel) const;
+
     /**
      * @brief Get the pressure offset
      * @return The pressure offset
      */
-    [[nodiscard]] double getPressureOffset()const{return pressureOffset;}
+    [[nodiscard]] double getPressureOffset()const{return -pressureChannel.getCorrection().getOffset();}
     /**
-     * @brief Set the pressure offset
+     * @brief Set the pressure offset (subtracted from the measure)
      * @param newOffset Pressure offset
      */
-    void setPressureOffset(double newOffset){pressureOffset = newOffset;}
+    void setPressureOffset(double newOffset){
+        setCorrection(Channel::Pressure, ChannelCorrection{pressureChannel.getCorrection().getGain(), -newOffset});
+    }
 private:
     /// Sensor Data
     SensorData data = SensorData{};
-    /// Pressure offset for calibration
-    double pressureOffset = 0;
+    /// Temperature conversion (0.01°C per LSB) and correction
+    CorrectedChannel temperatureChannel{0.01, 0.0};
+    /// Pressure conversion (1/4096 hPa per LSB) and correction
+    CorrectedChannel pressureChannel{1.0 / 4096.0, 0.0};
     /**
      * @brief Definition of registers constants
      */
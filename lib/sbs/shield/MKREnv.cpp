@@ -8,8 +8,18 @@
 
 #include "MKREnv.h"
 #include "physic/conversions.h"
+#include "time/timing.h"
 
 namespace sbs::shield {
+/// HTS221 temperature variance (±0.5°C accuracy)
+constexpr double htsTemperatureNoise = 0.25;
+/// LPS22HB temperature variance (±1.5°C accuracy)
+constexpr double lpsTemperatureNoise = 2.25;
+
+MKREnv::MKREnv() :
+    htsSource{temperatureFusion.addSource(htsTemperatureNoise, true)},
+    lpsSource{temperatureFusion.addSource(lpsTemperatureNoise)} {
+}
 
 void MKREnv::init() {
     humidityTemperature.init();
@@ -22,7 +32,9 @@ const MKREnv::ShieldData& MKREnv::getValue() {
     auto tmpPres = pressureTemperature.getValue();
     auto UV = UVSense.getValue();
     data.humidity    = tmpHum.humidity;
-    data.temperature = (tmpHum.temperature + tmpPres.temperature) * 0.5;
+    uint32_t now     = time::millis();
+    temperatureFusion.update(htsSource, tmpHum.temperature, now);
+    data.temperature = temperatureFusion.update(lpsSource, tmpPres.temperature, now);
     data.pressure    = tmpPres.pressure;
     data.UVa = UV.uva;
     data.UVb = UV.uvb;
@@ -7,6 +7,7 @@
  */
 
 #pragma once
+#include "data/Fusion.h"
 #include "sensor/Hts221.h"
 #include "sensor/Lps22hb.h"
 #include "sensor/Veml6075.h"
@@ -32,7 +33,7 @@ public:
     /**
      * @brief Default constructor.
      */
-    MKREnv() = default;
+    MKREnv();
 
     /**
      * @brief The Data coming from sensor
@@ -105,6 +106,12 @@ public:
      * @return Pressure sensor
      */
     sensor::Lps22hb& gerPTSensor(){return pressureTemperature;}
+
+    /**
+     * @brief Access to the fusion of the two temperature sensors
+     * @return Temperature fusion
+     */
+    data::SensorFusion& getTemperatureFusion(){return temperatureFusion;}
 private:
     /// Sensor Data
     ShieldData data = ShieldData{};
@@ -114,6 +121,12 @@ private:
     sensor::Lps22hb pressureTemperature;
     /// UV sensor
     sensor::Veml6075 UVSense;
+    /// Fusion of the HTS221 (reference) and LPS22HB temperatures
+    data::SensorFusion temperatureFusion;
+    /// HTS221 source in the fusion
+    uint8_t htsSource;
+    /// LPS22HB source in the fusion
+    uint8_t lpsSource;
 };
 
 }// namespace sbs::shield
\ No newline at end of file
@@ -0,0 +1,155 @@
+/**
+ * @file Duration.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "timing.h"
+
+namespace sbs::time {
+
+/**
+ * @brief Signed time interval in microseconds
+ *
+ * 64 bits: ±292000 years, no wrap in practice.
+ */
+class Duration {
+public:
+    constexpr Duration() = default;
+
+    /**
+     * @brief Create from microseconds
+     * @param micro Amount of microseconds
+     * @return The duration
+     */
+    static constexpr Duration microseconds(int64_t micro) { return Duration{micro}; }
+
+    /**
+     * @brief Create from milliseconds
+     * @param milli Amount of milliseconds
+     * @return The duration
+     */
+    static constexpr Duration milliseconds(int64_t milli) { return Duration{milli * 1000}; }
+
+    /**
+     * @brief Create from seconds
+     * @param second Amount of seconds
+     * @return The duration
+     */
+    static constexpr Duration seconds(int64_t second) { return Duration{second * 1000000}; }
+
+    /**
+     * @brief Value in microseconds
+     * @return Microseconds
+     */
+    [[nodiscard]] constexpr int64_t toMicroseconds() const { return value; }
+
+    /**
+     * @brief Value in milliseconds (truncated)
+     * @return Milliseconds
+     */
+    [[nodiscard]] constexpr int64_t toMilliseconds() const { return value / 1000; }
+
+    /**
+     * @brief Value in seconds
+     * @return Seconds
+     */
+    [[nodiscard]] constexpr double toSeconds() const { return static_cast<double>(value) * 1e-6; }
+
+    constexpr Duration operator+(const Duration& other) const { return Duration{value + other.value}; }
+    constexpr Duration operator-(const Duration& other) const { return Duration{value - other.value}; }
+    constexpr Duration operator-() const { return Duration{-value}; }
+    constexpr Duration operator*(int64_t factor) const { return Duration{value * factor}; }
+    constexpr Duration operator/(int64_t divisor) const { return Duration{value / divisor}; }
+    Duration& operator+=(const Duration& other) {
+        value += other.value;
+        return *this;
+    }
+    Duration& operator-=(const Duration& other) {
+        value -= other.value;
+        return *this;
+    }
+    constexpr bool operator==(const Duration& other) const { return value == other.value; }
+    constexpr bool operator!=(const Duration& other) const { return value != other.value; }
+    constexpr bool operator<(const Duration& other) const { return value < other.value; }
+    constexpr bool operator<=(const Duration& other) const { return value <= other.value; }
+    constexpr bool operator>(const Duration& other) const { return value > other.value; }
+    constexpr bool operator>=(const Duration& other) const { return value >= other.value; }
+
+private:
+    /**
+     * @brief Constructor
+     * @param micro Amount of microseconds
+     */
+    constexpr explicit Duration(int64_t micro) :
+        value{micro} {}
+    /// Microseconds
+    int64_t value = 0;
+};
+
+/**
+ * @brief Point of the monotonic 64-bit clock (micros64)
+ *
+ * Instants stay ordered for the whole life of the program, whatever the wraps of the
+ * hardware counter.
+ */
+class Instant {
+public:
+    constexpr Instant() = default;
+
+    /**
+     * @brief Current time
+     * @return The instant
+     */
+    static Instant now() { return Instant{micros64()}; }
+
+    /**
+     * @brief Create from microseconds since start of program
+     * @param micro Amount of microseconds
+     * @return The instant
+     */
+    static constexpr Instant fromMicroseconds(uint64_t micro) { return Instant{micro}; }
+
+    /**
+     * @brief Microseconds since start of program
+     * @return Microseconds
+     */
+    [[nodiscard]] constexpr uint64_t toMicroseconds() const { return value; }
+
+    /**
+     * @brief Time since this instant
+     * @return The duration
+     */
+    [[nodiscard]] Duration elapsed() const { return now() - *this; }
+
+    constexpr Duration operator-(const Instant& other) const {
+        return Duration::microseconds(static_cast<int64_t>(value - other.value));
+    }
+    constexpr Instant operator+(const Duration& duration) const {
+        return Instant{value + static_cast<uint64_t>(duration.toMicroseconds())};
+    }
+    constexpr Instant operator-(const Duration& duration) const {
+        return Instant{value - static_cast<uint64_t>(duration.toMicroseconds())};
+    }
+    constexpr bool operator==(const Instant& other) const { return value == other.value; }
+    constexpr bool operator!=(const Instant& other) const { return value != other.value; }
+    constexpr bool operator<(const Instant& other) const { return value < other.value; }
+    constexpr bool operator<=(const Instant& other) const { return value <= other.value; }
+    constexpr bool operator>(const Instant& other) const { return value > other.value; }
+    constexpr bool operator>=(const Instant& other) const { return value >= other.value; }
+
+private:
+    /**
+     * @brief Constructor
+     * @param micro Microseconds since start of program
+     */
+    constexpr explicit Instant(uint64_t micro) :
+        value{micro} {}
+    /// Microseconds since start of program
+    uint64_t value = 0;
+};
+
+}// namespace sbs::time
@@ -0,0 +1,89 @@
+/**
+ * @file LoopMonitor.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "LoopMonitor.h"
+#include "core/LogLine.h"
+#include "core/Node.h"
+
+namespace sbs::time {
+
+/// Upper limit of the first histogram bucket in microseconds
+constexpr uint32_t firstBucketLimit = 16;
+
+void LoopMonitor::begin() {
+    start = clock();
+    idle  = 0;
+    if (started && period != 0) {
+        const uint32_t interval = start - lastStart;
+        const uint32_t jitter   = interval > period ? interval - period : period - interval;
+        if (jitter > maxJitter) maxJitter = jitter;
+        uint8_t bucket = 0;
+        uint32_t limit = firstBucketLimit;
+        while (bucket + 1 < bucketCount && jitter >= limit) {
+            ++bucket;
+            limit <<= 2U;
+        }
+        if (histogram[bucket] != 0xFFFF) ++histogram[bucket];
+    }
+    if (!started) lastReport = start;
+    lastStart = start;
+    started   = true;
+}
+
+void LoopMonitor::end() {
+    const uint32_t now     = clock();
+    const uint32_t elapsed = now - start;
+    const uint32_t busy    = elapsed > idle ? elapsed - idle : 0;
+    if (iterations == 0 || busy < minDuration) minDuration = busy;
+    if (busy > maxDuration) maxDuration = busy;
+    totalDuration += busy;
+    ++iterations;
+    if (period != 0 && busy > period) ++misses;
+    if (reportPeriod != 0 && now - lastReport >= reportPeriod * 1000U) {
+        report();
+        reset();
+        lastReport = now;
+    }
+}
+
+uint32_t LoopMonitor::getMeanDuration() const {
+    return iterations != 0 ? static_cast<uint32_t>(totalDuration / iterations) : 0;
+}
+
+void LoopMonitor::reset() {
+    iterations    = 0;
+    minDuration   = 0;
+    maxDuration   = 0;
+    totalDuration = 0;
+    maxJitter     = 0;
+    misses        = 0;
+    for (auto& count : histogram)
+        count = 0;
+}
+
+void LoopMonitor::report(const io::Verbosity& level) const {
+    using io::field;
+    if (static_cast<int>(level) > SBS_LOG_LEVEL || !io::isLogged(level)) return;
+    io::LogLine line;
+    io::appendAll(line, "LOOP", field("n", iterations), field("min", getMinDuration()), field("mean", getMeanDuration()),
+                  field("max", maxDuration), field("jitter", maxJitter), field("miss", misses), " hist=");
+    for (uint8_t bucket = 0; bucket < bucketCount; ++bucket) {
+        if (bucket != 0) line.append('/');
+        line.append(histogram[bucket]);
+    }
+    line.send(level);
+}
+
+/// The monitor of the main loop
+static NodeLocal<LoopMonitor> mainMonitor;
+
+LoopMonitor& loopMonitor() {
+    return mainMonitor.get();
+}
+
+}// namespace sbs::time
@@ -0,0 +1,175 @@
+/**
+ * @file LoopMonitor.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Print.h"
+#include "timing.h"
+
+/// Intended period of the main loop in microseconds (0: free running)
+#ifndef SBS_LOOP_PERIOD
+#define SBS_LOOP_PERIOD 0
+#endif
+/// Time between two loop reports in milliseconds (0: no report)
+#ifndef SBS_LOOP_REPORT_PERIOD
+#define SBS_LOOP_REPORT_PERIOD 0
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Worst case and jitter of the main loop iterations
+ *
+ * Each iteration is measured from its beginning to its end, without the idle sleep: this
+ * busy time tells if the work fits in the loop period. With an intended period, the
+ * jitter is the distance between the time separating two iteration starts and the period;
+ * an iteration whose busy time exceeds the period counts a deadline miss. The jitters go
+ * in a histogram (bucket limits growing by 4 from 16 µs).
+ *
+ * All times are in microseconds.
+ */
+class LoopMonitor {
+public:
+    /// Function giving the current time
+    using Clock = uint32_t (*)();
+    /// Number of buckets of the jitter histogram
+    static constexpr uint8_t bucketCount = 8;
+
+    /**
+     * @brief Define the intended period of the loop
+     * @param period_ Period in microseconds (0: free running, no jitter nor miss)
+     */
+    void setPeriod(uint32_t period_) { period = period_; }
+
+    /**
+     * @brief Intended period of the loop
+     * @return Period in microseconds
+     */
+    [[nodiscard]] uint32_t getPeriod() const { return period; }
+
+    /**
+     * @brief Mark the beginning of an iteration
+     */
+    void begin();
+
+    /**
+     * @brief Mark the end of an iteration
+     */
+    void end();
+
+    /**
+     * @brief Remove idle time from the current iteration
+     * @param micro Time spent sleeping
+     */
+    void addIdle(uint32_t micro) { idle += micro; }
+
+    /**
+     * @brief Number of measured iterations
+     * @return Iterations since the last reset
+     */
+    [[nodiscard]] uint32_t getIterations() const { return iterations; }
+
+    /**
+     * @brief Shortest busy time of an iteration
+     * @return Duration (0 if no iteration)
+     */
+    [[nodiscard]] uint32_t getMinDuration() const { return iterations != 0 ? minDuration : 0; }
+
+    /**
+     * @brief Longest busy time of an iteration
+     * @return Duration
+     */
+    [[nodiscard]] uint32_t getMaxDuration() const { return maxDuration; }
+
+    /**
+     * @brief Mean busy time of an iteration
+     * @return Duration (0 if no iteration)
+     */
+    [[nodiscard]] uint32_t getMeanDuration() const;
+
+    /**
+     * @brief Largest distance to the intended period
+     * @return Jitter
+     */
+    [[nodiscard]] uint32_t getMaxJitter() const { return maxJitter; }
+
+    /**
+     * @brief Number of iterations longer than the period
+     * @return Deadline misses
+     */
+    [[nodiscard]] uint32_t getMisses() const { return misses; }
+
+    /**
+     * @brief Number of jitters in a histogram bucket
+     * @param bucket The bucket (jitters under 16·4^bucket µs, the last one being unbounded)
+     * @return The jitters
+     */
+    [[nodiscard]] uint16_t getBucket(uint8_t bucket) const { return bucket < bucketCount ? histogram[bucket] : 0; }
+
+    /**
+     * @brief Clear the statistics
+     */
+    void reset();
+
+    /**
+     * @brief Print the statistics
+     * @param level The level of the line
+     */
+    void report(const io::Verbosity& level = io::Verbosity::Mute) const;
+
+    /**
+     * @brief Define the time between two reports (done at the end of an iteration)
+     * @param period_ Period in milliseconds (0: no report)
+     */
+    void setReportPeriod(uint32_t period_) { reportPeriod = period_; }
+
+    /**
+     * @brief Define the time source
+     * @param clock_ Function giving the current time in microseconds (time::micros by default)
+     */
+    void setClock(Clock clock_) { clock = clock_; }
+
+private:
+    /// Intended period
+    uint32_t period = SBS_LOOP_PERIOD;
+    /// Time between two reports in milliseconds
+    uint32_t reportPeriod = SBS_LOOP_REPORT_PERIOD;
+    /// Beginning of the current iteration
+    uint32_t start = 0;
+    /// Beginning of the previous iteration
+    uint32_t lastStart = 0;
+    /// Time of the last report
+    uint32_t lastReport = 0;
+    /// Idle time of the current iteration
+    uint32_t idle = 0;
+    /// Measured iterations
+    uint32_t iterations = 0;
+    /// Shortest busy time
+    uint32_t minDuration = 0;
+    /// Longest busy time
+    uint32_t maxDuration = 0;
+    /// Total busy time
+    uint64_t totalDuration = 0;
+    /// Largest jitter
+    uint32_t maxJitter = 0;
+    /// Deadline misses
+    uint32_t misses = 0;
+    /// Jitters per bucket
+    uint16_t histogram[bucketCount] = {};
+    /// If a previous iteration start is known
+    bool started = false;
+    /// Time source
+    Clock clock = &micros;
+};
+
+/**
+ * @brief Access to the monitor of the main loop
+ * @return The main loop monitor
+ */
+LoopMonitor& loopMonitor();
+
+}// namespace sbs::time
@@ -0,0 +1,99 @@
+/**
+ * @file Profiler.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Profiler.h"
+#include "core/LogLine.h"
+#include "core/Node.h"
+#include <string.h>
+
+namespace sbs::time {
+
+/// Upper limit of the first histogram bucket in microseconds
+constexpr uint32_t firstBucketLimit = 16;
+
+Profiler::ZoneId Profiler::addZone(const char* name) {
+    for (ZoneId zone = 0; zone < zoneCount; ++zone) {
+        if (strcmp(zones[zone].name, name) == 0) return zone;
+    }
+    if (zoneCount == maxZones) return invalidZone;
+    if (zoneCount == 0) windowStart = clock();
+    zones[zoneCount].name = name;
+    return zoneCount++;
+}
+
+void Profiler::record(ZoneId zone, uint32_t duration) {
+    if (zone >= zoneCount) return;
+    Zone& stats = zones[zone];
+    if (stats.count == 0 || duration < stats.minimum) stats.minimum = duration;
+    if (duration > stats.maximum) stats.maximum = duration;
+    ++stats.count;
+    stats.total += duration;
+    uint8_t bucket = 0;
+    uint32_t limit = firstBucketLimit;
+    while (bucket + 1 < bucketCount && duration >= limit) {
+        ++bucket;
+        limit <<= 2U;
+    }
+    if (stats.histogram[bucket] != 0xFFFF) ++stats.histogram[bucket];
+}
+
+uint32_t Profiler::getMean(ZoneId zone) const {
+    if (getCount(zone) == 0) return 0;
+    return static_cast<uint32_t>(zones[zone].total / zones[zone].count);
+}
+
+double Profiler::getLoad(ZoneId zone) const {
+    const uint32_t window = clock() - windowStart;
+    if (zone >= zoneCount || window == 0) return 0.0;
+    return static_cast<double>(zones[zone].total) * 100.0 / static_cast<double>(window);
+}
+
+uint16_t Profiler::getBucket(ZoneId zone, uint8_t bucket) const {
+    return zone < zoneCount && bucket < bucketCount ? zones[zone].histogram[bucket] : 0;
+}
+
+void Profiler::reset() {
+    for (uint8_t zone = 0; zone < zoneCount; ++zone) {
+        const char* name = zones[zone].name;
+        zones[zone]      = Zone{};
+        zones[zone].name = name;
+    }
+    windowStart = clock();
+}
+
+void Profiler::report(const io::Verbosity& level) const {
+    using io::field;
+    for (ZoneId zone = 0; zone < zoneCount; ++zone) {
+        if (zones[zone].count == 0) continue;
+        if (static_cast<int>(level) > SBS_LOG_LEVEL || !io::isLogged(level)) return;
+        io::LogLine line;
+        io::appendAll(line, "PROF ", zones[zone].name, field("n", zones[zone].count), field("min", getMin(zone)),
+                      field("mean", getMean(zone)), field("max", getMax(zone)), field("load", io::fixed(getLoad(zone), 2)),
+                      "% hist=");
+        for (uint8_t bucket = 0; bucket < bucketCount; ++bucket) {
+            if (bucket != 0) line.append('/');
+            line.append(zones[zone].histogram[bucket]);
+        }
+        line.send(level);
+    }
+}
+
+void Profiler::update() {
+    if (period == 0 || clock() - windowStart < period * 1000U) return;
+    report();
+    reset();
+}
+
+/// The profiler of the zone macros
+static NodeLocal<Profiler> mainProfiler;
+
+Profiler& profiler() {
+    return mainProfiler.get();
+}
+
+}// namespace sbs::time
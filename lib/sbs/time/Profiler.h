@@ -0,0 +1,249 @@
+/**
+ * @file Profiler.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Print.h"
+#include "timing.h"
+
+/// Compile the profiling zones (build flag)
+#ifndef SBS_PROFILING
+#define SBS_PROFILING 0
+#endif
+/// Maximum number of profiling zones
+#ifndef SBS_PROFILE_ZONES
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_PROFILE_ZONES 4
+#else
+#define SBS_PROFILE_ZONES 16
+#endif
+#endif
+/// Time between two profiling reports in milliseconds (0: no report)
+#ifndef SBS_PROFILE_REPORT_PERIOD
+#define SBS_PROFILE_REPORT_PERIOD 10000
+#endif
+
+/// Paste two tokens (after their expansion)
+#define SBS_PROFILE_JOIN2(first, second) first##second
+#define SBS_PROFILE_JOIN(first, second) SBS_PROFILE_JOIN2(first, second)
+
+#ifdef NATIVE
+/// Storage of the zone of a call site: looked up at each pass, each node having its own profiler
+#define SBS_PROFILE_SITE const
+#else
+/// Storage of the zone of a call site: registered once
+#define SBS_PROFILE_SITE static const
+#endif
+
+/**
+ * @brief Measure the time spent until the end of the enclosing scope
+ * @param name Name of the zone (string literal)
+ *
+ * The zone is registered at the first pass (of each node on native). Without
+ * SBS_PROFILING, the macro vanishes.
+ */
+#if SBS_PROFILING
+#define SBS_PROFILE_ZONE(name)                                                                                                   \
+    SBS_PROFILE_SITE ::sbs::time::Profiler::ZoneId SBS_PROFILE_JOIN(sbsZone, __LINE__) = ::sbs::time::profiler().addZone(name); \
+    const ::sbs::time::ProfileScope SBS_PROFILE_JOIN(sbsScope, __LINE__) { SBS_PROFILE_JOIN(sbsZone, __LINE__) }
+#else
+#define SBS_PROFILE_ZONE(name) \
+    do {                       \
+    } while (0)
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Execution time statistics of code zones
+ *
+ * Each zone counts its runs and keeps the minimum, maximum and total duration, and a
+ * histogram of the durations (bucket limits growing by 4 from 16 µs). The report gives,
+ * for each zone run since the last report, the statistics and the share of the time
+ * spent in the zone (load).
+ *
+ * Durations are measured in microseconds.
+ */
+class Profiler {
+public:
+    /// Identifier of a zone
+    using ZoneId = uint8_t;
+    /// Function giving the current time
+    using Clock = uint32_t (*)();
+    /// Identifier of no zone
+    static constexpr ZoneId invalidZone = 0xFF;
+    /// Maximum number of zones
+    static constexpr uint8_t maxZones = SBS_PROFILE_ZONES;
+    /// Number of buckets of the histograms
+    static constexpr uint8_t bucketCount = 8;
+    static_assert(maxZones < invalidZone, "Too many profiling zones");
+
+    /**
+     * @brief Register a zone
+     * @param name Name of the zone (must outlive the profiler)
+     * @return The zone identifier, or invalidZone if the table is full
+     *
+     * A name already registered gives its zone.
+     */
+    ZoneId addZone(const char* name);
+
+    /**
+     * @brief Add a run of a zone
+     * @param zone The zone
+     * @param duration The run's duration in microseconds
+     */
+    void record(ZoneId zone, uint32_t duration);
+
+    /**
+     * @brief Number of registered zones
+     * @return The zone count
+     */
+    [[nodiscard]] uint8_t getZoneCount() const { return zoneCount; }
+
+    /**
+     * @brief Name of a zone
+     * @param zone The zone
+     * @return The name, or nullptr
+     */
+    [[nodiscard]] const char* getName(ZoneId zone) const { return zone < zoneCount ? zones[zone].name : nullptr; }
+
+    /**
+     * @brief Number of runs of a zone
+     * @param zone The zone
+     * @return Runs since the last reset
+     */
+    [[nodiscard]] uint32_t getCount(ZoneId zone) const { return zone < zoneCount ? zones[zone].count : 0; }
+
+    /**
+     * @brief Shortest run of a zone
+     * @param zone The zone
+     * @return Duration in microseconds (0 if no run)
+     */
+    [[nodiscard]] uint32_t getMin(ZoneId zone) const { return getCount(zone) != 0 ? zones[zone].minimum : 0; }
+
+    /**
+     * @brief Longest run of a zone
+     * @param zone The zone
+     * @return Duration in microseconds
+     */
+    [[nodiscard]] uint32_t getMax(ZoneId zone) const { return zone < zoneCount ? zones[zone].maximum : 0; }
+
+    /**
+     * @brief Mean run of a zone
+     * @param zone The zone
+     * @return Duration in microseconds (0 if no run)
+     */
+    [[nodiscard]] uint32_t getMean(ZoneId zone) const;
+
+    /**
+     * @brief Share of the time spent in a zone since the last reset
+     * @param zone The zone
+     * @return Load in percents
+     */
+    [[nodiscard]] double getLoad(ZoneId zone) const;
+
+    /**
+     * @brief Number of runs of a zone in a histogram bucket
+     * @param zone The zone
+     * @param bucket The bucket (durations under 16·4^bucket µs, the last one being unbounded)
+     * @return The runs
+     */
+    [[nodiscard]] uint16_t getBucket(ZoneId zone, uint8_t bucket) const;
+
+    /**
+     * @brief Clear the statistics (the zones stay registered)
+     */
+    void reset();
+
+    /**
+     * @brief Print the statistics of the zones run since the last reset
+     * @param level The level of the lines
+     */
+    void report(const io::Verbosity& level = io::Verbosity::Mute) const;
+
+    /**
+     * @brief Define the time between two reports of update()
+     * @param period_ Period in milliseconds (0: no report)
+     */
+    void setReportPeriod(uint32_t period_) { period = period_; }
+
+    /**
+     * @brief Report and reset when the report period is elapsed
+     */
+    void update();
+
+    /**
+     * @brief Define the time source
+     * @param clock_ Function giving the current time in microseconds (time::micros by default)
+     */
+    void setClock(Clock clock_) {
+        clock       = clock_;
+        windowStart = clock();
+    }
+
+    /**
+     * @brief Current time of the profiler
+     * @return Microseconds
+     */
+    [[nodiscard]] uint32_t now() const { return clock(); }
+
+private:
+    /**
+     * @brief Statistics of a zone
+     */
+    struct Zone {
+        const char* name                = nullptr;///< Name of the zone
+        uint32_t count                  = 0;      ///< Number of runs
+        uint32_t minimum                = 0;      ///< Shortest run
+        uint32_t maximum                = 0;      ///< Longest run
+        uint64_t total                  = 0;      ///< Time spent in the zone
+        uint16_t histogram[bucketCount] = {};     ///< Runs per duration bucket
+    };
+    /// The zones
+    Zone zones[maxZones];
+    /// Number of registered zones
+    uint8_t zoneCount = 0;
+    /// Time of the last reset
+    uint32_t windowStart = 0;
+    /// Time between two reports in milliseconds
+    uint32_t period = SBS_PROFILE_REPORT_PERIOD;
+    /// Time source
+    Clock clock = &micros;
+};
+
+/**
+ * @brief Access to the profiler of the zone macros
+ * @return The main profiler
+ */
+Profiler& profiler();
+
+/**
+ * @brief Measure the time spent in a scope (see SBS_PROFILE_ZONE)
+ */
+class ProfileScope {
+public:
+    /**
+     * @brief Constructor: start of the run
+     * @param zone_ The zone
+     */
+    explicit ProfileScope(Profiler::ZoneId zone_) :
+        zone{zone_}, start{profiler().now()} {}
+    /**
+     * @brief Destructor: end of the run
+     */
+    ~ProfileScope() { profiler().record(zone, profiler().now() - start); }
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    /// The zone
+    Profiler::ZoneId zone;
+    /// Start of the run
+    uint32_t start;
+};
+
+}// namespace sbs::time
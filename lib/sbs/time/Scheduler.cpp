@@ -0,0 +1,151 @@
+/**
+ * @file Scheduler.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Scheduler.h"
+#include "Profiler.h"
+#include "core/Node.h"
+
+namespace sbs::time {
+
+Scheduler::TaskId Scheduler::add(const Task& task) {
+    for (TaskId id = 0; id < maxTasks; ++id) {
+        if (tasks[id].function == nullptr) {
+            tasks[id] = task;
+            return id;
+        }
+    }
+    return invalidTask;
+}
+
+Scheduler::TaskId Scheduler::addPeriodic(const char* name, uint32_t period, TaskFunction function, void* context, uint8_t priority) {
+    if (function == nullptr || period == 0) return invalidTask;
+    Task task;
+    task.function = function;
+    task.context  = context;
+    task.name     = name;
+    task.period   = period;
+    task.due      = clock() + period;
+    task.priority = priority;
+    return add(task);
+}
+
+Scheduler::TaskId Scheduler::addOneShot(const char* name, uint32_t delay, TaskFunction function, void* context, uint8_t priority) {
+    if (function == nullptr) return invalidTask;
+    Task task;
+    task.function = function;
+    task.context  = context;
+    task.name     = name;
+    task.due      = clock() + delay;
+    task.priority = priority;
+    return add(task);
+}
+
+void Scheduler::remove(TaskId id) {
+    if (!exists(id)) return;
+    tasks[id] = Task{};
+}
+
+void Scheduler::clear() {
+    for (auto& task : tasks)
+        task = Task{};
+}
+
+void Scheduler::reschedule(TaskId id, uint32_t delay) {
+    if (!exists(id)) return;
+    tasks[id].due = clock() + delay;
+}
+
+void Scheduler::setPriority(TaskId id, uint8_t priority) {
+    if (!exists(id)) return;
+    tasks[id].priority = priority;
+}
+
+void Scheduler::setDeadline(TaskId id, uint32_t deadline) {
+    if (!exists(id)) return;
+    tasks[id].deadline = deadline;
+}
+
+void Scheduler::setEnabled(TaskId id, bool enabled) {
+    if (!exists(id) || tasks[id].enabled == enabled) return;
+    tasks[id].enabled = enabled;
+    if (enabled && tasks[id].period != 0)
+        tasks[id].due = clock() + tasks[id].period;
+}
+
+uint8_t Scheduler::getTaskCount() const {
+    uint8_t count = 0;
+    for (const auto& task : tasks) {
+        if (task.function != nullptr) ++count;
+    }
+    return count;
+}
+
+uint32_t Scheduler::lateness(const Task& task) {
+    if (task.deadline != 0) return task.deadline;
+    return task.period != 0 ? task.period : forever;
+}
+
+uint32_t Scheduler::update() {
+    const uint32_t now = clock();
+    bool ran           = false;
+    // runs are bounded: a task adding itself without delay cannot stall the main loop
+    for (uint8_t runs = 0; runs < maxTasks; ++runs) {
+        TaskId best       = invalidTask;
+        uint32_t bestTime = 0;
+        for (TaskId id = 0; id < maxTasks; ++id) {
+            const Task& task = tasks[id];
+            if (task.function == nullptr || !task.enabled || isBefore(now, task.due)) continue;
+            // latest start time without missing the deadline
+            const uint32_t late  = lateness(task);
+            const uint32_t limit = task.due + (late > 0x7FFFFFFF ? 0x7FFFFFFF : late);
+            if (best == invalidTask || task.priority > tasks[best].priority ||
+                (task.priority == tasks[best].priority && isBefore(limit, bestTime))) {
+                best     = id;
+                bestTime = limit;
+            }
+        }
+        if (best == invalidTask) break;
+        Task& task = tasks[best];
+        if (now - task.due > lateness(task) && task.missed != 0xFFFF) ++task.missed;
+        TaskFunction function = task.function;
+        void* context         = task.context;
+        if (task.period != 0) {
+            task.due += task.period;
+            // too late for the next run too: skip the lost runs instead of bursting
+            if (!isBefore(now, task.due)) task.due = now + task.period;
+        } else {
+            task = Task{};
+        }
+        current = best;
+        {
+            SBS_PROFILE_ZONE("tasks");
+            function(context);
+        }
+        current = invalidTask;
+        ran     = true;
+    }
+    // time until the next task
+    uint32_t idle = forever;
+    for (const auto& task : tasks) {
+        if (task.function == nullptr || !task.enabled) continue;
+        const uint32_t wait = isBefore(now, task.due) ? task.due - now : 0;
+        if (wait < idle) idle = wait;
+    }
+    if (!ran && idle != 0 && idleHook != nullptr)
+        idleHook(idle);
+    return idle;
+}
+
+/// The scheduler run by the main loop
+static NodeLocal<Scheduler> mainScheduler;
+
+Scheduler& scheduler() {
+    return mainScheduler.get();
+}
+
+}// namespace sbs::time
@@ -0,0 +1,220 @@
+/**
+ * @file Scheduler.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "timing.h"
+
+/// Maximum number of tasks of a scheduler
+#ifndef SBS_SCHEDULER_TASKS
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_SCHEDULER_TASKS 4
+#else
+#define SBS_SCHEDULER_TASKS 12
+#endif
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Cooperative task scheduler
+ *
+ * Tasks are plain functions run from the main loop: they must return quickly and never
+ * wait (a long job is split into steps, each step being a run of the task). Periodic tasks
+ * run every period, one-shot tasks once after a delay.
+ *
+ * When several tasks are due, the one with the highest priority runs first, then the one
+ * with the earliest deadline. A task started later than its deadline (maximum lateness
+ * after its due time) counts a miss. When no task is due, the idle hook receives the time
+ * until the next one.
+ *
+ * All times are in milliseconds and wrap safely.
+ */
+class Scheduler {
+public:
+    /// Identifier of a task
+    using TaskId = uint8_t;
+    /// Function of a task
+    using TaskFunction = void (*)(void* context);
+    /// Function called when no task is due, with the time until the next one
+    using IdleHook = void (*)(uint32_t idle);
+    /// Function giving the current time
+    using Clock = uint32_t (*)();
+    /// Identifier of no task
+    static constexpr TaskId invalidTask = 0xFF;
+    /// Idle time when there is no task
+    static constexpr uint32_t forever = 0xFFFFFFFF;
+    /// Maximum number of tasks
+    static constexpr uint8_t maxTasks = SBS_SCHEDULER_TASKS;
+    static_assert(maxTasks < invalidTask, "Too many tasks");
+
+    /**
+     * @brief Add a periodic task
+     * @param name Name of the task (for diagnostics, must outlive the task)
+     * @param period Time between two runs
+     * @param function The task's function
+     * @param context Argument of the function
+     * @param priority Priority (higher runs first)
+     * @return The task identifier or invalidTask if the table is full
+     *
+     * The first run happens one period after now.
+     */
+    TaskId addPeriodic(const char* name, uint32_t period, TaskFunction function, void* context = nullptr, uint8_t priority = 0);
+
+    /**
+     * @brief Add a task running once
+     * @param name Name of the task (for diagnostics, must outlive the task)
+     * @param delay Time before the run
+     * @param function The task's function
+     * @param context Argument of the function
+     * @param priority Priority (higher runs first)
+     * @return The task identifier or invalidTask if the table is full
+     *
+     * The task is removed after its run.
+     */
+    TaskId addOneShot(const char* name, uint32_t delay, TaskFunction function, void* context = nullptr, uint8_t priority = 0);
+
+    /**
+     * @brief Remove a task
+     * @param id The task
+     */
+    void remove(TaskId id);
+
+    /**
+     * @brief Remove all the tasks (before the setup runs again)
+     */
+    void clear();
+
+    /**
+     * @brief Define the next run of a task
+     * @param id The task
+     * @param delay Time before the next run
+     */
+    void reschedule(TaskId id, uint32_t delay);
+
+    /**
+     * @brief Define the priority of a task
+     * @param id The task
+     * @param priority The priority (higher runs first)
+     */
+    void setPriority(TaskId id, uint8_t priority);
+
+    /**
+     * @brief Define the deadline of a task
+     * @param id The task
+     * @param deadline Maximum lateness of a run (0: the period, or none for one-shot tasks)
+     */
+    void setDeadline(TaskId id, uint32_t deadline);
+
+    /**
+     * @brief Suspend or resume a task
+     * @param id The task
+     * @param enabled If the task runs
+     *
+     * A resumed periodic task runs one period later.
+     */
+    void setEnabled(TaskId id, bool enabled);
+
+    /**
+     * @brief Check if a task exists
+     * @param id The task
+     * @return True if the task is scheduled
+     */
+    [[nodiscard]] bool exists(TaskId id) const { return id < maxTasks && tasks[id].function != nullptr; }
+
+    /**
+     * @brief Name of a task
+     * @param id The task
+     * @return The name, or nullptr
+     */
+    [[nodiscard]] const char* getName(TaskId id) const { return exists(id) ? tasks[id].name : nullptr; }
+
+    /**
+     * @brief Number of runs of a task started later than its deadline
+     * @param id The task
+     * @return Missed deadlines
+     */
+    [[nodiscard]] uint16_t getMissed(TaskId id) const { return exists(id) ? tasks[id].missed : 0; }
+
+    /**
+     * @brief Number of scheduled tasks
+     * @return The task count
+     */
+    [[nodiscard]] uint8_t getTaskCount() const;
+
+    /**
+     * @brief Task being run
+     * @return The task, or invalidTask outside of a task
+     */
+    [[nodiscard]] TaskId getCurrent() const { return current; }
+
+    /**
+     * @brief Define the idle hook
+     * @param hook The function (nullptr for none)
+     */
+    void setIdleHook(IdleHook hook) { idleHook = hook; }
+
+    /**
+     * @brief Define the time source
+     * @param clock_ Function giving the current time in milliseconds (time::millis by default)
+     */
+    void setClock(Clock clock_) { clock = clock_; }
+
+    /**
+     * @brief Run the due tasks
+     * @return Time until the next task (forever if none)
+     *
+     * Each due task runs once; the idle hook is called if no task was due.
+     */
+    uint32_t update();
+
+private:
+    /**
+     * @brief Scheduling data of a task
+     */
+    struct Task {
+        TaskFunction function = nullptr;///< The task's function, nullptr for a free slot
+        void* context         = nullptr;///< Argument of the function
+        const char* name      = nullptr;///< Name of the task
+        uint32_t period       = 0;      ///< Time between two runs, 0 for one-shot tasks
+        uint32_t due          = 0;      ///< Time of the next run
+        uint32_t deadline     = 0;      ///< Maximum lateness, 0 for default
+        uint16_t missed       = 0;      ///< Runs started after the deadline
+        uint8_t priority      = 0;      ///< Priority, higher runs first
+        bool enabled          = true;   ///< If the task runs
+    };
+    /// The tasks
+    Task tasks[maxTasks];
+    /// Task being run
+    TaskId current = invalidTask;
+    /// Function called when no task is due
+    IdleHook idleHook = nullptr;
+    /// Time source
+    Clock clock = &millis;
+
+    /**
+     * @brief Add a task in a free slot
+     * @param task The task
+     * @return The task identifier or invalidTask if the table is full
+     */
+    TaskId add(const Task& task);
+
+    /**
+     * @brief Effective deadline of a task
+     * @param task The task
+     * @return Maximum lateness (forever if none)
+     */
+    [[nodiscard]] static uint32_t lateness(const Task& task);
+};
+
+/**
+ * @brief Access to the scheduler run by the main loop
+ * @return The main scheduler
+ */
+Scheduler& scheduler();
+
+}// namespace sbs::time
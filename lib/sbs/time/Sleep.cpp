@@ -0,0 +1,138 @@
+/**
+ * @file Sleep.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Sleep.h"
+#include "LoopMonitor.h"
+#include "TimerWheel.h"
+#include "core/EventLoop.h"
+#include "core/LogSink.h"
+#include "core/Node.h"
+#include "timing.h"
+#if defined(NATIVE)
+#include <atomic>
+#include <chrono>
+#include <thread>
+#elif defined(ARDUINO_ARCH_AVR)
+#include <Arduino.h>
+#include <avr/sleep.h>
+#else
+#include <Arduino.h>
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Sleep state of a node
+ */
+struct SleepState {
+#ifdef NATIVE
+    std::atomic<bool> wakeRequested{false};///< If a wake up is requested
+#else
+    volatile bool wakeRequested = false;///< If a wake up is requested
+#endif
+    bool deepSleep     = false;///< If the deep sleep is allowed
+    uint32_t sleepTime = 0;    ///< Time spent sleeping
+};
+
+/// The sleep state of each node
+static NodeLocal<SleepState> state;
+
+/**
+ * @brief Wait for the next event (interrupt, tick) in low power
+ * @param milli Maximum wait in milliseconds
+ */
+static void waitEvent(uint32_t milli) {
+#if defined(NATIVE)
+    if (isVirtualTime()) {
+        advance(static_cast<uint64_t>(milli) * 1000U);
+        return;
+    }
+    // slices keep the wake up latency low
+    std::this_thread::sleep_for(std::chrono::milliseconds(milli < 10 ? milli : 10));
+#elif defined(ARDUINO_ARCH_AVR)
+    // idle mode keeps timer 0 (millis) and the UART running, its tick wakes the CPU
+    (void) milli;
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_enable();
+    sleep_cpu();
+    sleep_disable();
+#elif defined(ARDUINO_ARCH_SAMD)
+    // the SysTick interrupt (millis) wakes the CPU every millisecond
+    (void) milli;
+    __WFI();
+#elif defined(ESP8266)
+    // modem sleep only: the CPU keeps running, the radio sleeps between the beacons when
+    // associated (the light sleep would need wifi_set_sleep_type(LIGHT_SLEEP_T))
+    ::delay(milli < 10 ? milli : 10);
+#else
+    (void) milli;
+#endif
+}
+
+/**
+ * @brief Take the wake up requests of the node: calls of wakeUp and posts to its event loop
+ * @param loop The event loop of the node
+ * @return True if a wake up was requested
+ */
+static bool takeWakeUp(EventLoop& loop) {
+    const bool posted = loop.takeWakeUp();
+    // cleared only when set, as for the event loop
+    if (!state->wakeRequested) return posted;
+    state->wakeRequested = false;
+    return true;
+}
+
+bool sleep(uint32_t milli) {
+    // the loop of the sleeping node: the posts of other threads wake the node owning the loop
+    EventLoop& loop      = events();
+    const uint32_t start = millis();
+    uint32_t elapsed     = 0;
+    bool woken           = takeWakeUp(loop);
+    while (!woken && elapsed < milli) {
+        waitEvent(milli - elapsed);
+        // the polled sources may post events, which request the wake up
+        loop.poll();
+        elapsed = elapsedMillis(start);
+        woken   = takeWakeUp(loop);
+    }
+    state->sleepTime += elapsed;
+    return woken;
+}
+
+void wakeUp() {
+    state->wakeRequested = true;
+}
+
+void idleSleep(uint32_t idle) {
+    io::flushLog();
+    if (events().pending()) return;
+    // the timers of the main wheel may expire before the next task
+    const uint32_t timerIdle = timers().getIdle();
+    if (timerIdle < idle) idle = timerIdle;
+    if (idle == 0) return;
+#ifdef ESP8266
+    if (state->deepSleep && idle != 0xFFFFFFFF && idle >= SBS_DEEP_SLEEP_THRESHOLD) {
+        ESP.deepSleep(static_cast<uint64_t>(idle) * 1000U);
+        return;
+    }
+#endif
+    const uint32_t start = micros();
+    sleep(idle < SBS_SLEEP_MAX ? idle : SBS_SLEEP_MAX);
+    // the sleep is not part of the loop's busy time
+    loopMonitor().addIdle(micros() - start);
+}
+
+void setDeepSleep(bool allowed) {
+    state->deepSleep = allowed;
+}
+
+uint32_t getSleepTime() {
+    return state->sleepTime;
+}
+
+}// namespace sbs::time
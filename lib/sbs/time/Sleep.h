@@ -0,0 +1,72 @@
+/**
+ * @file Sleep.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#ifdef ARDUINO_ARCH_AVR
+#include <stdint.h>
+#else
+#include <cstdint>
+#endif
+
+/// Longest sleep of the idle hook in milliseconds (the main loop runs at least this often)
+#ifndef SBS_SLEEP_MAX
+#define SBS_SLEEP_MAX 1000
+#endif
+/// Shortest idle time worth a deep sleep in milliseconds (ESP8266 only)
+#ifndef SBS_DEEP_SLEEP_THRESHOLD
+#define SBS_DEEP_SLEEP_THRESHOLD 60000
+#endif
+
+/**
+ * @brief Low-power waiting
+ *
+ * The CPU waits in the deepest sleep that keeps the RAM and the time base: idle mode
+ * on AVR, wait-for-interrupt on SAMD (the standby mode stops the tick), a delay on
+ * ESP8266 (modem sleep only, the CPU keeps running), and a system sleep on native. The sleep ends at the
+ * deadline or as soon as wakeUp is called, for instance from a data-ready interrupt, or
+ * an event is posted to the event loop of the sleeping node.
+ */
+namespace sbs::time {
+
+/**
+ * @brief Sleep until a deadline or a wake up request
+ * @param milli Maximum sleep duration in milliseconds
+ * @return True if woken before the deadline
+ */
+bool sleep(uint32_t milli);
+
+/**
+ * @brief Request the end of the current (or next) sleep
+ *
+ * Safe to call from an interrupt.
+ */
+void wakeUp();
+
+/**
+ * @brief Idle hook of the scheduler: flush the log then sleep until the next task or timer
+ * @param idle Time until the next task in milliseconds
+ *
+ * The sleep is limited to SBS_SLEEP_MAX so that the main loop still runs regularly.
+ * With deep sleep allowed, a long idle time (at least SBS_DEEP_SLEEP_THRESHOLD) puts
+ * the ESP8266 in deep sleep: the node restarts at the deadline.
+ */
+void idleSleep(uint32_t idle);
+
+/**
+ * @brief Allow the deep sleep (state lost, restart at wake up) for long idle times
+ * @param allowed If deep sleep is allowed (ESP8266 only, needs GPIO16 wired to reset)
+ */
+void setDeepSleep(bool allowed);
+
+/**
+ * @brief Total time spent sleeping
+ * @return Slept milliseconds since start
+ */
+[[nodiscard]] uint32_t getSleepTime();
+
+}// namespace sbs::time
@@ -0,0 +1,199 @@
+/**
+ * @file TimerWheel.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "TimerWheel.h"
+#include "core/Node.h"
+
+namespace sbs::time {
+
+/// Mask of a slot index
+constexpr uint32_t slotMask = TimerWheel::slotCount - 1U;
+
+/**
+ * @brief Range of the levels up to a level
+ * @param level The level
+ * @return Number of milliseconds covered by the levels 0 to level
+ */
+static uint64_t range(uint8_t level) {
+    return static_cast<uint64_t>(1) << (TimerWheel::slotBits * (level + 1U));
+}
+
+void TimerWheel::prepare() {
+    if (ready) return;
+    for (auto& head : heads)
+        head = none;
+    current = clock();
+    ready   = true;
+}
+
+void TimerWheel::place(uint8_t index, uint32_t from) {
+    Timer& timer  = timers[index];
+    uint16_t list = 0;
+    if (isBefore(timer.expiration, from)) {
+        // overdue: first processed tick
+        list = from & slotMask;
+    } else {
+        const uint32_t delta = timer.expiration - from;
+        uint8_t level        = 0;
+        while (level < levels && delta >= range(level))
+            ++level;
+        if (level == levels) {
+            // beyond the range: wait for the last turn of the last level, then place again
+            level          = levels - 1;
+            const auto top = static_cast<uint32_t>((from >> (slotBits * level)) - 1U) & slotMask;
+            list           = static_cast<uint16_t>(level * slotCount + top);
+        } else {
+            list = static_cast<uint16_t>(level * slotCount + ((timer.expiration >> (slotBits * level)) & slotMask));
+        }
+    }
+    timer.list     = list;
+    timer.previous = none;
+    timer.next     = heads[list];
+    if (timer.next != none)
+        timers[timer.next].previous = index;
+    heads[list] = index;
+}
+
+void TimerWheel::unlink(uint8_t index) {
+    Timer& timer = timers[index];
+    if (timer.previous != none) {
+        timers[timer.previous].next = timer.next;
+    } else {
+        heads[timer.list] = timer.next;
+    }
+    if (timer.next != none)
+        timers[timer.next].previous = timer.previous;
+    timer.next     = none;
+    timer.previous = none;
+}
+
+TimerWheel::TimerId TimerWheel::start(uint32_t delay, Callback callback, void* context, uint32_t period) {
+    prepare();
+    if (callback == nullptr) return invalidTimer;
+    for (uint8_t index = 0; index < maxTimers; ++index) {
+        Timer& timer = timers[index];
+        if (timer.callback != nullptr) continue;
+        timer.callback   = callback;
+        timer.context    = context;
+        timer.expiration = clock() + delay;
+        timer.period     = period;
+        ++timer.generation;
+        place(index, current + 1U);
+        ++active;
+        return static_cast<TimerId>(timer.generation << 8U | index);
+    }
+    return invalidTimer;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    if (!isActive(id)) return false;
+    const auto index = static_cast<uint8_t>(id & 0xFFU);
+    unlink(index);
+    timers[index].callback = nullptr;
+    --active;
+    return true;
+}
+
+bool TimerWheel::isActive(TimerId id) const {
+    const auto index = static_cast<uint8_t>(id & 0xFFU);
+    return index < maxTimers && timers[index].callback != nullptr && timers[index].generation == (id >> 8U);
+}
+
+uint32_t TimerWheel::getIdle() const {
+    if (active == 0) return forever;
+    uint32_t next = forever;
+    for (uint8_t level = 0; level < levels; ++level) {
+        const uint8_t shift = slotBits * level;
+        const uint32_t base = current >> shift;
+        for (uint16_t step = 1; step <= slotCount; ++step) {
+            if (heads[level * slotCount + ((base + step) & slotMask)] == none) continue;
+            // a slot is processed when its span starts
+            const uint32_t date = static_cast<uint32_t>((base + step) << shift);
+            const uint32_t wait = date - current;
+            if (wait < next) next = wait;
+            break;
+        }
+    }
+    const uint32_t elapsed = clock() - current;
+    return next > elapsed ? next - elapsed : 0;
+}
+
+void TimerWheel::cascade(uint8_t level, uint8_t slot) {
+    const uint16_t list = static_cast<uint16_t>(level * slotCount + slot);
+    while (heads[list] != none) {
+        const uint8_t index = heads[list];
+        unlink(index);
+        place(index, current);
+    }
+}
+
+void TimerWheel::expire() {
+    const uint16_t list = current & slotMask;
+    while (heads[list] != none) {
+        const uint8_t index = heads[list];
+        unlink(index);
+        Timer& timer = timers[index];
+        if (isBefore(current, timer.expiration)) {
+            place(index, current + 1U);
+            continue;
+        }
+        Callback callback = timer.callback;
+        void* context     = timer.context;
+        if (timer.period != 0) {
+            timer.expiration += timer.period;
+            place(index, current + 1U);
+        } else {
+            timer.callback = nullptr;
+            --active;
+        }
+        callback(context);
+    }
+}
+
+bool TimerWheel::firstLevelEmpty() const {
+    for (uint8_t slot = 0; slot < slotCount; ++slot) {
+        if (heads[slot] != none) return false;
+    }
+    return true;
+}
+
+void TimerWheel::update() {
+    prepare();
+    const uint32_t now = clock();
+    while (isBefore(current, now)) {
+        if (active == 0) {
+            current = now;
+            break;
+        }
+        if (firstLevelEmpty()) {
+            // nothing to expire before the next turn of the first level
+            const uint32_t turnEnd = current | slotMask;
+            if (isBefore(current, turnEnd)) {
+                current = isBefore(turnEnd, now) ? turnEnd : now;
+                continue;
+            }
+        }
+        ++current;
+        // at the start of a turn, the slot of the next level moves down (highest level first)
+        uint8_t top = 0;
+        while (top + 1 < levels && ((current >> (slotBits * (top + 1U))) << (slotBits * (top + 1U))) == current)
+            ++top;
+        for (uint8_t level = top; level > 0; --level)
+            cascade(level, (current >> (slotBits * level)) & slotMask);
+        expire();
+    }
+}
+
+/// The timer wheel updated by the main loop
+static NodeLocal<TimerWheel> mainTimers;
+
+TimerWheel& timers() {
+    return mainTimers.get();
+}
+
+}// namespace sbs::time
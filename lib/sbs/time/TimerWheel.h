@@ -0,0 +1,195 @@
+/**
+ * @file TimerWheel.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "timing.h"
+
+/// Maximum number of running timers
+#ifndef SBS_TIMERS
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_TIMERS 8
+#else
+#define SBS_TIMERS 32
+#endif
+#endif
+/// Number of bits of the slot index of a wheel level (slots per level: 2^bits)
+#ifndef SBS_TIMER_SLOT_BITS
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_TIMER_SLOT_BITS 4
+#else
+#define SBS_TIMER_SLOT_BITS 6
+#endif
+#endif
+/// Number of levels of the wheel
+#ifndef SBS_TIMER_LEVELS
+#define SBS_TIMER_LEVELS 4
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Hierarchical timer wheel
+ *
+ * Many concurrent timeouts (driver waits, retries, network timeouts) with a fixed memory
+ * footprint: the timers come from a pool and each wheel slot is a linked list, so
+ * starting and cancelling a timer are O(1). The first level has a slot per millisecond;
+ * each next level has a slot per turn of the previous one, whose timers are moved down
+ * when their turn comes. Timers beyond the wheel range wait in the last level and are
+ * placed again at each of its turns. All times wrap safely.
+ */
+class TimerWheel {
+public:
+    /// Identifier of a timer (pool index and generation)
+    using TimerId = uint16_t;
+    /// Function called at expiration
+    using Callback = void (*)(void* context);
+    /// Function giving the current time
+    using Clock = uint32_t (*)();
+    /// Identifier of no timer
+    static constexpr TimerId invalidTimer = 0xFFFF;
+    /// Maximum number of timers
+    static constexpr uint8_t maxTimers = SBS_TIMERS;
+    /// Number of bits of a level's slot index
+    static constexpr uint8_t slotBits = SBS_TIMER_SLOT_BITS;
+    /// Number of slots per level
+    static constexpr uint8_t slotCount = 1U << slotBits;
+    /// Number of levels
+    static constexpr uint8_t levels = SBS_TIMER_LEVELS;
+    /// Idle time when there is no timer
+    static constexpr uint32_t forever = 0xFFFFFFFF;
+    static_assert(maxTimers < 0xFF, "Too many timers");
+    static_assert(slotBits * levels <= 32, "Timer wheel too large");
+
+    /**
+     * @brief Start a timer
+     * @param delay Time before expiration in milliseconds
+     * @param callback Function called at expiration
+     * @param context Argument of the function
+     * @param period Time between two expirations (0 for a single expiration)
+     * @return The timer identifier, or invalidTimer if the pool is empty
+     */
+    TimerId start(uint32_t delay, Callback callback, void* context = nullptr, uint32_t period = 0);
+
+    /**
+     * @brief Stop a timer
+     * @param id The timer
+     * @return False if the timer is not running (already expired or cancelled)
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief Check if a timer is running
+     * @param id The timer
+     * @return True if running
+     */
+    [[nodiscard]] bool isActive(TimerId id) const;
+
+    /**
+     * @brief Number of running timers
+     * @return The count
+     */
+    [[nodiscard]] uint8_t getActiveCount() const { return active; }
+
+    /**
+     * @brief Time until the next expiration (lower bound)
+     * @return Milliseconds (forever if no timer)
+     */
+    [[nodiscard]] uint32_t getIdle() const;
+
+    /**
+     * @brief Define the time source
+     * @param clock_ Function giving the current time in milliseconds (time::millis by default)
+     *
+     * Must be defined before starting timers.
+     */
+    void setClock(Clock clock_) {
+        clock   = clock_;
+        current = clock();
+    }
+
+    /**
+     * @brief Expire the due timers
+     */
+    void update();
+
+private:
+    /// No timer (end of list)
+    static constexpr uint8_t none = 0xFF;
+    /// Number of slot lists
+    static constexpr uint16_t listCount = static_cast<uint16_t>(slotCount) * levels;
+
+    /**
+     * @brief A timer
+     */
+    struct Timer {
+        Callback callback   = nullptr;///< Function called at expiration, nullptr if free
+        void* context       = nullptr;///< Argument of the function
+        uint32_t expiration = 0;      ///< Expiration time
+        uint32_t period     = 0;      ///< Time between two expirations
+        uint16_t list       = 0;      ///< Slot list holding the timer
+        uint8_t next        = none;   ///< Next timer in the list
+        uint8_t previous    = none;   ///< Previous timer in the list
+        uint8_t generation  = 0;      ///< Incremented at each use of the pool entry
+    };
+    /// Timer pool
+    Timer timers[maxTimers];
+    /// First timer of each slot list
+    uint8_t heads[listCount];
+    /// If the slot lists are initialized
+    bool ready = false;
+    /// Last processed time
+    uint32_t current = 0;
+    /// Number of running timers
+    uint8_t active = 0;
+    /// Time source
+    Clock clock = &millis;
+
+    /**
+     * @brief Initialize the lists at first use
+     */
+    void prepare();
+
+    /**
+     * @brief Put a timer in the slot matching its expiration
+     * @param index The timer
+     * @param from First time not yet processed
+     */
+    void place(uint8_t index, uint32_t from);
+
+    /**
+     * @brief Remove a timer from its slot list
+     * @param index The timer
+     */
+    void unlink(uint8_t index);
+
+    /**
+     * @brief Move the timers of a level's slot to the lower levels
+     * @param level The level
+     * @param slot The slot
+     */
+    void cascade(uint8_t level, uint8_t slot);
+
+    /**
+     * @brief Run the timers of the current first-level slot
+     */
+    void expire();
+
+    /**
+     * @brief Check if the first level is empty
+     * @return True if no timer in the first level
+     */
+    [[nodiscard]] bool firstLevelEmpty() const;
+};
+
+/**
+ * @brief Access to the timer wheel updated by the main loop
+ * @return The main timer wheel
+ */
+TimerWheel& timers();
+
+}// namespace sbs::time
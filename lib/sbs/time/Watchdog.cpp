@@ -0,0 +1,264 @@
+/**
+ * @file Watchdog.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "Watchdog.h"
+#include "Scheduler.h"
+#include "core/LogLine.h"
+#include "core/Node.h"
+#include <string.h>
+#ifndef NATIVE
+#include <Arduino.h>
+#endif
+#ifdef ARDUINO_ARCH_AVR
+#include <avr/wdt.h>
+#endif
+
+namespace sbs::time {
+
+/// Marker of a valid reset record ("WDOG")
+constexpr uint32_t recordMagic = 0x574F4447;
+
+#if defined(ESP8266)
+static_assert(sizeof(ResetRecord) % 4 == 0, "The RTC memory is written by blocks of 4 bytes");
+#elif !defined(NATIVE)
+/// Record of the last reset, in a RAM area not cleared at start
+static ResetRecord resetRecord __attribute__((section(".noinit")));
+
+/**
+ * @brief Access to the record of the last reset
+ * @return The record
+ */
+static ResetRecord& lastReset() {
+    return resetRecord;
+}
+#else
+/// Record of the last reset of each node
+static NodeLocal<ResetRecord> resetRecords;
+
+/**
+ * @brief Access to the record of the last reset of the current node
+ * @return The record
+ */
+static ResetRecord& lastReset() {
+    return resetRecords.get();
+}
+#endif
+
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAMD)
+/// If the early warning interrupt recorded a hang
+static volatile bool warned = false;
+#endif
+
+/**
+ * @brief Write the reset record
+ * @param cause Cause of the reset
+ * @param culprit Name of the client or task at fault
+ */
+static void saveRecord(ResetCause cause, const char* culprit) {
+    ResetRecord record{};
+    record.magic  = recordMagic;
+    record.uptime = millis();
+    record.cause  = cause;
+    for (uint8_t i = 0; culprit != nullptr && i + 1 < SBS_WATCHDOG_NAME_SIZE && culprit[i] != '\0'; ++i)
+        record.culprit[i] = culprit[i];
+#ifdef ESP8266
+    ESP.rtcUserMemoryWrite(SBS_WATCHDOG_RTC_BLOCK, reinterpret_cast<uint32_t*>(&record), sizeof(record));
+#else
+    lastReset() = record;
+#endif
+}
+
+/**
+ * @brief Reset the board
+ */
+static void hardwareReset() {
+#if defined(ARDUINO_ARCH_AVR)
+    wdt_enable(WDTO_15MS);
+    for (;;) {}
+#elif defined(ARDUINO_ARCH_SAMD)
+    NVIC_SystemReset();
+#elif defined(ESP8266)
+    ESP.restart();
+#endif
+}
+
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAMD)
+/**
+ * @brief Record the culprit of a hang, the hardware reset being near
+ */
+static void earlyWarning() {
+    const char* culprit = watchdog().findLate();
+    if (culprit == nullptr) culprit = scheduler().getName(scheduler().getCurrent());
+    if (culprit == nullptr) culprit = "loop";
+    saveRecord(ResetCause::Hang, culprit);
+    warned = true;
+}
+#endif
+
+#if defined(ARDUINO_ARCH_AVR)
+ISR(WDT_vect) {
+    earlyWarning();
+}
+#elif defined(ARDUINO_ARCH_SAMD)
+extern "C" void WDT_Handler() {
+    earlyWarning();
+    WDT->INTFLAG.bit.EW = 1;
+}
+#endif
+
+Watchdog::ClientId Watchdog::add(const char* name, uint32_t deadline) {
+    if (name == nullptr) return invalidClient;
+    // a setup run again gets its client back instead of leaving a stale one
+    for (ClientId id = 0; id < maxClients; ++id) {
+        if (clients[id].name == nullptr || strcmp(clients[id].name, name) != 0) continue;
+        clients[id].deadline = deadline;
+        clients[id].last     = clock();
+        return id;
+    }
+    for (ClientId id = 0; id < maxClients; ++id) {
+        if (clients[id].name != nullptr) continue;
+        clients[id].name     = name;
+        clients[id].deadline = deadline;
+        clients[id].last     = clock();
+        return id;
+    }
+    return invalidClient;
+}
+
+void Watchdog::remove(ClientId id) {
+    if (id < maxClients) clients[id] = Client{};
+}
+
+void Watchdog::checkIn(ClientId id) {
+    if (id < maxClients) clients[id].last = clock();
+}
+
+const char* Watchdog::findLate() const {
+    const uint32_t now = clock();
+    for (const auto& client : clients) {
+        if (client.name != nullptr && now - client.last > client.deadline) return client.name;
+    }
+    return nullptr;
+}
+
+void Watchdog::start(uint32_t timeout) {
+#if defined(ARDUINO_ARCH_AVR)
+    // 15 ms × 2^n
+    uint8_t prescaler = 0;
+    while (prescaler < WDTO_8S && (15UL << (prescaler + 1U)) <= timeout)
+        ++prescaler;
+    noInterrupts();
+    wdt_reset();
+    wdt_enable(prescaler);
+    // interrupt first, reset at the next timeout
+    WDTCSR |= _BV(WDIE);
+    interrupts();
+#elif defined(ARDUINO_ARCH_SAMD)
+    // 1024 Hz clock from the ultra low power oscillator, period of 8 × 2^n cycles
+    uint8_t period = 0;
+    while (period < WDT_CONFIG_PER_16K_Val && (1000UL << (period + 1U)) / 128U <= timeout)
+        ++period;
+    GCLK->GENDIV.reg  = GCLK_GENDIV_ID(2) | GCLK_GENDIV_DIV(4);
+    GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(2) | GCLK_GENCTRL_GENEN | GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_DIVSEL;
+    while (GCLK->STATUS.bit.SYNCBUSY) {}
+    GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_WDT | GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK2;
+    WDT->CTRL.reg = 0;
+    while (WDT->STATUS.bit.SYNCBUSY) {}
+    WDT->CONFIG.bit.PER = period;
+    // early warning at half of the period
+    WDT->EWCTRL.bit.EWOFFSET = period > 0 ? period - 1 : 0;
+    WDT->INTFLAG.bit.EW      = 1;
+    WDT->INTENSET.bit.EW     = 1;
+    NVIC_EnableIRQ(WDT_IRQn);
+    WDT->CTRL.bit.ENABLE = 1;
+    while (WDT->STATUS.bit.SYNCBUSY) {}
+#elif defined(ESP8266)
+    // the SDK timeouts are fixed
+    ESP.wdtEnable(timeout);
+#else
+    (void) timeout;
+#endif
+    const uint32_t now = clock();
+    for (auto& client : clients)
+        client.last = now;
+    started = true;
+}
+
+void Watchdog::update() {
+    if (!started) return;
+    const char* late = findLate();
+    if (late != nullptr) {
+        fire(late);
+        return;
+    }
+#if defined(ARDUINO_ARCH_AVR)
+    wdt_reset();
+    WDTCSR |= _BV(WDIE);
+#elif defined(ARDUINO_ARCH_SAMD)
+    // a clear during the synchronization of the previous one is not needed
+    if (!WDT->STATUS.bit.SYNCBUSY) WDT->CLEAR.reg = WDT_CLEAR_CLEAR_KEY;
+#elif defined(ESP8266)
+    ESP.wdtFeed();
+#endif
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAMD)
+    // the loop came back after an early warning: not a hang
+    if (warned) {
+        lastReset().magic = 0;
+        warned            = false;
+    }
+#endif
+}
+
+void Watchdog::fire(const char* culprit) {
+    saveRecord(ResetCause::Deadline, culprit);
+    io::log(io::Verbosity::Error, "Watchdog: late client ", culprit);
+    io::flushLog();
+    if (resetHandler != nullptr) {
+        resetHandler();
+    } else {
+        hardwareReset();
+    }
+    // no reset (native): new deadlines
+    const uint32_t now = clock();
+    for (auto& client : clients)
+        client.last = now;
+}
+
+bool Watchdog::getLastReset(ResetRecord& record) {
+#ifdef ESP8266
+    ESP.rtcUserMemoryRead(SBS_WATCHDOG_RTC_BLOCK, reinterpret_cast<uint32_t*>(&record), sizeof(record));
+    if (record.magic == recordMagic) {
+        record.culprit[SBS_WATCHDOG_NAME_SIZE - 1] = '\0';
+        ResetRecord cleared{};
+        ESP.rtcUserMemoryWrite(SBS_WATCHDOG_RTC_BLOCK, reinterpret_cast<uint32_t*>(&cleared), sizeof(cleared));
+        return true;
+    }
+    // hang caught by the SDK watchdogs: no culprit
+    const uint32_t reason = ESP.getResetInfoPtr()->reason;
+    if (reason != REASON_WDT_RST && reason != REASON_SOFT_WDT_RST) return false;
+    record       = ResetRecord{};
+    record.magic = recordMagic;
+    record.cause = ResetCause::Hang;
+    return true;
+#else
+    if (lastReset().magic != recordMagic) return false;
+    record                                     = lastReset();
+    record.culprit[SBS_WATCHDOG_NAME_SIZE - 1] = '\0';
+    lastReset().magic                          = 0;
+    return true;
+#endif
+}
+
+/// The watchdog fed by the main loop
+static NodeLocal<Watchdog> mainWatchdog;
+
+Watchdog& watchdog() {
+    return mainWatchdog.get();
+}
+
+}// namespace sbs::time
@@ -0,0 +1,182 @@
+/**
+ * @file Watchdog.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "timing.h"
+
+/// Maximum number of watchdog clients
+#ifndef SBS_WATCHDOG_CLIENTS
+#ifdef ARDUINO_ARCH_AVR
+#define SBS_WATCHDOG_CLIENTS 4
+#else
+#define SBS_WATCHDOG_CLIENTS 12
+#endif
+#endif
+/// Default timeout of the hardware watchdog in milliseconds
+#ifndef SBS_WATCHDOG_TIMEOUT
+#define SBS_WATCHDOG_TIMEOUT 8000
+#endif
+/// Size of the culprit name kept over a reset (with the terminating zero)
+#ifndef SBS_WATCHDOG_NAME_SIZE
+#define SBS_WATCHDOG_NAME_SIZE 16
+#endif
+/// First block (4 bytes) of the RTC user memory used for the reset record (ESP8266 only)
+#ifndef SBS_WATCHDOG_RTC_BLOCK
+#define SBS_WATCHDOG_RTC_BLOCK 0
+#endif
+
+namespace sbs::time {
+
+/**
+ * @brief Cause of a watchdog reset
+ */
+enum struct ResetCause : uint8_t {
+    None,    ///< No watchdog reset
+    Deadline,///< A client did not check in within its deadline
+    Hang,    ///< The main loop stopped (hardware watchdog)
+};
+
+/**
+ * @brief Description of the last watchdog reset, kept in a RAM area not cleared at start
+ */
+struct ResetRecord {
+    uint32_t magic;                      ///< Validity marker
+    uint32_t uptime;                     ///< Time of the reset in milliseconds since start
+    ResetCause cause;                    ///< Cause of the reset
+    char culprit[SBS_WATCHDOG_NAME_SIZE];///< Name of the client or task at fault
+};
+
+/**
+ * @brief Watchdog service
+ *
+ * The hardware watchdog is fed by the main loop only while every registered client has
+ * checked in within its own deadline. When a client is late, the culprit is recorded and
+ * the board resets at once; when the main loop itself hangs (a driver waiting forever),
+ * the hardware watchdog resets the board. On AVR and SAMD its early warning interrupt
+ * records the late client, or else the running task, just before. After the reset,
+ * getLastReset gives the record.
+ *
+ * Hardware: watchdog timer in interrupt and reset mode on AVR (timeout rounded down to
+ * 15 ms × 2^n, at most 8 s, the reset comes one timeout after the interrupt), WDT with early
+ * warning on SAMD (at most 16 s), SDK watchdogs on ESP8266 (fixed timeouts, the record is
+ * kept in the RTC memory). Native builds have no hardware watchdog: the late clients
+ * are recorded and the reset handler is called.
+ */
+class Watchdog {
+public:
+    /// Identifier of a client
+    using ClientId = uint8_t;
+    /// Function resetting the board
+    using ResetHandler = void (*)();
+    /// Function giving the current time
+    using Clock = uint32_t (*)();
+    /// Identifier of no client
+    static constexpr ClientId invalidClient = 0xFF;
+    /// Maximum number of clients
+    static constexpr uint8_t maxClients = SBS_WATCHDOG_CLIENTS;
+    static_assert(maxClients < invalidClient, "Too many watchdog clients");
+
+    /**
+     * @brief Register a client
+     * @param name Name of the client (must outlive the client)
+     * @param deadline Longest time between two check-ins in milliseconds
+     * @return The client identifier, or invalidClient if the table is full
+     *
+     * The deadline starts at the registration. A name already registered gets its client
+     * back, with the new deadline.
+     */
+    ClientId add(const char* name, uint32_t deadline);
+
+    /**
+     * @brief Unregister a client
+     * @param id The client
+     */
+    void remove(ClientId id);
+
+    /**
+     * @brief Tell that a client is alive
+     * @param id The client
+     */
+    void checkIn(ClientId id);
+
+    /**
+     * @brief Find a client late for its check-in
+     * @return The name of the first late client, or nullptr
+     */
+    [[nodiscard]] const char* findLate() const;
+
+    /**
+     * @brief Arm the hardware watchdog
+     * @param timeout The hardware timeout in milliseconds
+     *
+     * The main loop must run more often than the timeout.
+     */
+    void start(uint32_t timeout = SBS_WATCHDOG_TIMEOUT);
+
+    /**
+     * @brief Check if the watchdog is armed
+     * @return True if started
+     */
+    [[nodiscard]] bool isStarted() const { return started; }
+
+    /**
+     * @brief Feed the hardware watchdog, or reset if a client is late (called by the main loop)
+     */
+    void update();
+
+    /**
+     * @brief Define the function resetting the board
+     * @param handler The function (nullptr for the default of the target)
+     */
+    void setResetHandler(ResetHandler handler) { resetHandler = handler; }
+
+    /**
+     * @brief Define the time source
+     * @param clock_ Function giving the current time in milliseconds (time::millis by default)
+     */
+    void setClock(Clock clock_) { clock = clock_; }
+
+    /**
+     * @brief Get the record of the last watchdog reset (once)
+     * @param record Output: the record
+     * @return False if the last reset was not caused by the watchdog
+     */
+    static bool getLastReset(ResetRecord& record);
+
+private:
+    /**
+     * @brief A client
+     */
+    struct Client {
+        const char* name  = nullptr;///< Name of the client, nullptr if free
+        uint32_t deadline = 0;      ///< Longest time between two check-ins
+        uint32_t last     = 0;      ///< Time of the last check-in
+    };
+    /// The clients
+    Client clients[maxClients];
+    /// If the hardware watchdog is armed
+    bool started = false;
+    /// Function resetting the board
+    ResetHandler resetHandler = nullptr;
+    /// Time source
+    Clock clock = &millis;
+
+    /**
+     * @brief Record the culprit, then reset the board
+     * @param culprit Name of the late client
+     */
+    void fire(const char* culprit);
+};
+
+/**
+ * @brief Access to the watchdog fed by the main loop
+ * @return The main watchdog
+ */
+Watchdog& watchdog();
+
+}// namespace sbs::time
@@ -7,8 +7,11 @@
  */
 
 #include "timing.h"
+#include "core/Node.h"
 #ifdef NATIVE
+#include <atomic>
 #include <chrono>
+#include <thread>
 #else
 #include <Arduino.h>
 #endif
@@ -30,31 +33,83 @@ using microseconds = std::chrono::microseconds;
 
 /// Save of the program start date
 static const time_point startingPoint = internal_clock::now();
+
+/**
+ * @brief Virtual clock of a node
+ */
+struct VirtualClock {
+    std::atomic<bool> active{SBS_VIRTUAL_TIME != 0};///< If the virtual clock is used
+    std::atomic<uint64_t> date{0};                 ///< Date of the virtual clock in microseconds
+};
+
+/// The virtual clock of each node
+static NodeLocal<VirtualClock> virtualClock;
+
+/**
+ * @brief Wait until a date: sleep, then spin for the last millisecond (for accuracy)
+ * @param deadline The end of the wait
+ */
+static void waitUntil(const time_point& deadline) {
+    const auto margin = milliseconds(1);
+    auto now          = internal_clock::now();
+    if (deadline - now > margin)
+        std::this_thread::sleep_for(deadline - now - margin);
+    while (internal_clock::now() < deadline)
+        ;
+}
 #endif
 
 uint32_t millis() {
 #ifdef NATIVE
+    if (virtualClock->active)
+        return static_cast<uint32_t>(virtualClock->date / 1000U);
     return std::chrono::duration_cast<milliseconds>(internal_clock::now() - startingPoint).count();
 #else
     return ::millis();
 #endif
 }
 
-uint32_t micros() { return micros64(); }
+uint64_t millis64() { return micros64() / 1000U; }
+
+uint32_t micros() {
+#ifdef NATIVE
+    return static_cast<uint32_t>(micros64());
+#else
+    // the hardware counter itself: micros64 updates its wrap count, not to be done in interrupts
+    return ::micros();
+#endif
+}
+
+#if !defined(NATIVE) && !defined(ARDUINO_ARCH_ESP8266)
+/// Last read of the hardware counter
+static uint32_t lastMicros = 0;
+/// Number of wraps of the hardware counter
+static uint32_t microsWraps = 0;
+#endif
 
 uint64_t micros64() {
 #ifdef NATIVE
+    if (virtualClock->active)
+        return virtualClock->date;
     return std::chrono::duration_cast<microseconds>(internal_clock::now() - startingPoint).count();
+#elif defined(ARDUINO_ARCH_ESP8266)
+    return ::micros64();
 #else
-    return ::micros();
+    const uint32_t now = ::micros();
+    if (now < lastMicros)
+        ++microsWraps;
+    lastMicros = now;
+    return static_cast<uint64_t>(microsWraps) << 32U | now;
 #endif
 }
 
 void delay(uint32_t milli) {
 #ifdef NATIVE
-    time_point start = internal_clock::now();
-    while (std::chrono::duration_cast<milliseconds>(internal_clock::now() - start).count() < milli)
-        ;
+    if (virtualClock->active) {
+        virtualClock->date += static_cast<uint64_t>(milli) * 1000U;
+        return;
+    }
+    waitUntil(internal_clock::now() + milliseconds(milli));
 #else
     ::delay(milli);
 #endif
@@ -62,12 +117,34 @@ void delay(uint32_t milli) {
 
 void delayMicroseconds(uint32_t micro) {
 #ifdef NATIVE
-    time_point start = internal_clock::now();
-    while (std::chrono::duration_cast<microseconds>(internal_clock::now() - start).count() < micro)
-        ;
+    if (virtualClock->active) {
+        virtualClock->date += micro;
+        return;
+    }
+    waitUntil(internal_clock::now() + microseconds(micro));
 #else
     ::delayMicroseconds(micro);
 #endif
 }
 
+#ifdef NATIVE
+void setVirtualTime(bool active) {
+    if (active && !virtualClock->active)
+        virtualClock->date = std::chrono::duration_cast<microseconds>(internal_clock::now() - startingPoint).count();
+    virtualClock->active = active;
+}
+
+bool isVirtualTime() {
+    return virtualClock->active;
+}
+
+void setTime(uint64_t micro) {
+    virtualClock->date = micro;
+}
+
+void advance(uint64_t micro) {
+    virtualClock->date += micro;
+}
+#endif
+
 }// namespace sbs::time
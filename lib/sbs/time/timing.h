@@ -13,6 +13,11 @@
 #include <cstdint>
 #endif
 
+/// Use the virtual clock from start (native only)
+#ifndef SBS_VIRTUAL_TIME
+#define SBS_VIRTUAL_TIME 0
+#endif
+
 /**
  * @brief Namespace gathering the time functions
  */
@@ -24,17 +29,46 @@ namespace sbs::time {
 uint32_t millis();
 
 /**
- * @brief Get the amount microseconds since start of program
- * @return The microseconds since start of program
+ * @brief Get the amount milliseconds since start of program, without wrap
+ * @return The milliseconds since start of program
+ */
+uint64_t millis64();
+
+/**
+ * @brief Get the amount microseconds since start of program (usable in interrupt routines)
+ * @return The microseconds since start of program (wraps every 71 minutes)
  */
 uint32_t micros();
 
 /**
- * @brief Get the amount microseconds since start of program
+ * @brief Get the amount microseconds since start of program, without wrap
  * @return The microseconds since start of program
+ *
+ * On targets with a 32-bit hardware counter, the wraps are counted at each read: it must
+ * be read at least once per wrap period (71 minutes), which the main loop does. Not to be
+ * used in interrupt routines.
  */
 uint64_t micros64();
 
+/**
+ * @brief Wrap-safe comparison of two 32-bit times
+ * @param first The first time
+ * @param second The second time
+ * @return True if first is before second (valid if less than half the range apart)
+ */
+constexpr bool isBefore(uint32_t first, uint32_t second) {
+    return static_cast<int32_t>(first - second) < 0;
+}
+
+/**
+ * @brief Wrap-safe time elapsed since a date given by millis()
+ * @param since The date
+ * @return Milliseconds since the date
+ */
+inline uint32_t elapsedMillis(uint32_t since) {
+    return millis() - since;
+}
+
 /**
  * @brief Wait before next execution
  * @param milli Amount of millisecond to wait
@@ -47,4 +81,34 @@ void delay(uint32_t milli);
  */
 void delayMicroseconds(uint32_t micro);
 
+#ifdef NATIVE
+/**
+ * @brief Select the virtual clock (native only)
+ * @param active If the virtual clock is used
+ *
+ * The virtual clock only moves when asked to: the delays advance it at once instead of
+ * waiting, so simulations run much faster than real time while keeping the order of the
+ * events. It starts at the current real date. Each node has its own clock (see Node).
+ */
+void setVirtualTime(bool active);
+
+/**
+ * @brief Check if the virtual clock is used (native only)
+ * @return True if virtual
+ */
+bool isVirtualTime();
+
+/**
+ * @brief Define the date of the virtual clock (native only)
+ * @param micro Microseconds since start of program
+ */
+void setTime(uint64_t micro);
+
+/**
+ * @brief Move the virtual clock forward (native only)
+ * @param micro Amount of microseconds
+ */
+void advance(uint64_t micro);
+#endif
+
 }// namespace sbs::time
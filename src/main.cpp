@@ -1,127 +1,144 @@
 
-#include <core/Print.h>
+#include <core/LogLine.h>
+#include <data/Fusion.h>
+#include <io/CalibrationCache.h>
 #include <physic/conversions.h>
 #include <sbs.h>
 #include <sensor/Bme280.h>
 #include <sensor/Bq24195l.h>
 #include <shield/MKREnv.h>
-#include <time/timing.h>
+#include <time/Scheduler.h>
+#include <time/Sleep.h>
+#include <time/Watchdog.h>
 
 sbs::shield::MKREnv ENV;
 sbs::sensor::Bq24195l PowerManager;
 sbs::sensor::BME280 bme;
+sbs::data::SensorFusion temperatureFusion;
+sbs::data::SensorFusion pressureFusion;
+uint8_t envTemperature = temperatureFusion.addSource(0.25, true);
+uint8_t bmeTemperature = temperatureFusion.addSource(1.0);
+uint8_t envPressure    = pressureFusion.addSource(0.01, true);
+uint8_t bmePressure    = pressureFusion.addSource(0.01);
+/// LPS22HB pressure correction
+const sbs::sensor::ChannelCorrection lpsPressureCorrection{1.0, -2.4119};
 
 
 #ifdef ARDUINO_SAMD_MKRWIFI1010
 #include <Arduino.h>
 #endif
 
-void sbs::setup() {
-    ENV.init();
-    ENV.gerPTSensor().setPressureOffset(2.4119);
-    PowerManager.init();
-    bme.init();
-#ifdef ARDUINO_SAMD_MKRWIFI1010
-    pinMode(ADC_BATTERY, INPUT);
-#endif
-    //PowerManager.getSettings().setFastChargeCurrent(2.2);
-    //PowerManager.getSettings().setChargeVoltage(4.208);
-    //PowerManager.getSettings().battPreChargeToFastCharge = sbs::sensor::Bq24195l::Settings::BattPreChargeToFastCharge::V28;
-    //PowerManager.getSettings().dpdmDetection = sbs::sensor::Bq24195l::Settings::DPDMDetection::No;
-    //PowerManager.ApplySettings();
-}
+/// Watchdog client of the housekeeping
+static sbs::time::Watchdog::ClientId housekeepingClient = sbs::time::Watchdog::invalidClient;
 
-void sbs::loop() {
+/**
+ * @brief Check the presence of the devices
+ */
+static void housekeepingTask(void*) {
+    sbs::time::watchdog().checkIn(housekeepingClient);
     ENV.selfCheck();
     PowerManager.selfCheck();
     bme.selfCheck();
-    // ENV Shield
-    if (false) {
-        auto data_e = ENV.getValue();
-        {
-            sbs::io::logger(" ENV: T=");
-            sbs::io::logger(data_e.temperature);
-            sbs::io::logger(" P=");
-            sbs::io::logger(data_e.pressure);
-            sbs::io::logger(" QNH=");
-            sbs::io::logger(sbs::physic::computeQnh(295, data_e.pressure, data_e.temperature));
-            sbs::io::logger(" H=");
-            sbs::io::logger(data_e.humidity);
-        }
-        auto data_b = bme.getValue();
-        {
+}
 
-            sbs::io::logger(" BME: T=");
-            sbs::io::logger(data_b.temperature);
-            sbs::io::logger(" P=");
-            sbs::io::logger(data_b.pressure);
-            sbs::io::logger(" QNH=");
-            sbs::io::logger(sbs::physic::computeQnh(295, data_b.pressure, data_b.temperature));
-            sbs::io::logger(" H=");
-            sbs::io::logger(data_b.humidity);
-        }
-        {
-            sbs::io::logger(" Delta: T=");
-            sbs::io::logger(data_e.temperature - data_b.temperature);
-            sbs::io::logger(" P=");
-            sbs::io::logger(data_e.pressure - data_b.pressure);
-            sbs::io::logger(" QNH=");
-            sbs::io::logger(sbs::physic::computeQnh(295, data_e.pressure, data_e.temperature) - sbs::physic::computeQnh(295, data_b.pressure, data_b.temperature));
-            sbs::io::logger(" H=");
-            sbs::io::loggerln(data_e.humidity - data_b.humidity);
-        }
+/**
+ * @brief Read and fuse the environment sensors
+ */
+static void environmentTask(void*) {
+    using sbs::io::field;
+    auto data_e = ENV.getValue();
+    sbs::io::log(sbs::io::Verbosity::Mute, "ENV:", field("T", data_e.temperature), field("P", data_e.pressure),
+                 field("QNH", sbs::physic::computeQnh(295, data_e.pressure, data_e.temperature)), field("H", data_e.humidity));
+    auto data_b = bme.getValue();
+    sbs::io::log(sbs::io::Verbosity::Mute, "BME:", field("T", data_b.temperature), field("P", data_b.pressure),
+                 field("QNH", sbs::physic::computeQnh(295, data_b.pressure, data_b.temperature)), field("H", data_b.humidity));
+    {
+        uint32_t now = sbs::time::millis();
+        temperatureFusion.update(envTemperature, data_e.temperature, now);
+        pressureFusion.update(envPressure, data_e.pressure, now);
+        double temperature = temperatureFusion.update(bmeTemperature, data_b.temperature, now);
+        double pressure    = pressureFusion.update(bmePressure, data_b.pressure, now);
+        sbs::io::log(sbs::io::Verbosity::Mute, "Fused:", field("T", temperature), field("P", pressure),
+                     field("QNH", sbs::physic::computeQnh(295, pressure, temperature)),
+                     field("biasT", temperatureFusion.getBias(bmeTemperature)), field("biasP", pressureFusion.getBias(bmePressure)));
     }
-    // power management
-    if (true) {
-#ifdef ARDUINO_SAMD_MKRWIFI1010
-        double voltage = analogRead(ADC_BATTERY) * (4.3 / 1023.0);
-        sbs::io::logger("BaT: V=");
-        sbs::io::loggerln(voltage);
-        //sbs::io::logger(" ");
-        PowerManager.setChargingMode(sbs::sensor::Bq24195l::ChargingMode::Normal);
-        sbs::io::loggerln("Status registers: ");
-        sbs::io::loggerln(PowerManager.readSystemStatusRegister(),sbs::io::IntFormat::Binary);
-        sbs::io::loggerln(PowerManager.readFaultRegister(),sbs::io::IntFormat::Binary);
+}
 
+/**
+ * @brief Report the power status
+ */
+static void powerTask(void*) {
+#ifdef ARDUINO_SAMD_MKRWIFI1010
+    double voltage = analogRead(ADC_BATTERY) * (4.3 / 1023.0);
+    sbs::io::log(sbs::io::Verbosity::Mute, "BaT:", sbs::io::field("V", voltage));
+    PowerManager.setChargingMode(sbs::sensor::Bq24195l::ChargingMode::Normal);
+    sbs::io::log(sbs::io::Verbosity::Mute, "Status registers:",
+                 sbs::io::field("system", sbs::io::bin(PowerManager.readSystemStatusRegister())),
+                 sbs::io::field("fault", sbs::io::bin(PowerManager.readFaultRegister())));
 #endif
-        sbs::io::logger(" -- Power Status: ");
-        if (!PowerManager.presence()) {
-            sbs::io::loggerln("No Power Manager. ");
-        } else {
-            switch (PowerManager.getVbusStatus()) {
-            case sbs::sensor::Bq24195l::VBusStatus::unknown:
-                sbs::io::logger("Unknown .");
+    if (!PowerManager.presence()) {
+        sbs::io::log(sbs::io::Verbosity::Mute, " -- Power Status: No Power Manager.");
+    } else {
+        const char* vbus = "";
+        switch (PowerManager.getVbusStatus()) {
+        case sbs::sensor::Bq24195l::VBusStatus::unknown:
+            vbus = "Unknown .";
+            break;
+        case sbs::sensor::Bq24195l::VBusStatus::usb:
+            vbus = "USB power. ";
+            break;
+        case sbs::sensor::Bq24195l::VBusStatus::AdapterPort:
+            vbus = "Battery power. ";
+            break;
+        case sbs::sensor::Bq24195l::VBusStatus::otg:
+            vbus = "Powering USB by battery. ";
+            break;
+        }
+        const char* charge = "No battery detected.";
+        if (PowerManager.isInDPM()) {
+            switch (PowerManager.getChargeStatus()) {
+            case sbs::sensor::Bq24195l::ChargeStatus::NotCharging:
+                charge = "Not charging. ";
                 break;
-            case sbs::sensor::Bq24195l::VBusStatus::usb:
-                sbs::io::logger("USB power. ");
+            case sbs::sensor::Bq24195l::ChargeStatus::PreCharge:
+                charge = "Pre charge. ";
                 break;
-            case sbs::sensor::Bq24195l::VBusStatus::AdapterPort:
-                sbs::io::logger("Battery power. ");
+            case sbs::sensor::Bq24195l::ChargeStatus::FastCharging:
+                charge = "Fast charge. ";
                 break;
-            case sbs::sensor::Bq24195l::VBusStatus::otg:
-                sbs::io::logger("Powering USB by battery. ");
+            case sbs::sensor::Bq24195l::ChargeStatus::ChargeTerminaison:
+                charge = "End charge. ";
                 break;
             }
-            if (PowerManager.isInDPM()) {
-                switch (PowerManager.getChargeStatus()) {
-                case sbs::sensor::Bq24195l::ChargeStatus::NotCharging:
-                    sbs::io::logger("Not charging. ");
-                    break;
-                case sbs::sensor::Bq24195l::ChargeStatus::PreCharge:
-                    sbs::io::logger("Pre charge. ");
-                    break;
-                case sbs::sensor::Bq24195l::ChargeStatus::FastCharging:
-                    sbs::io::logger("Fast charge. ");
-                    break;
-                case sbs::sensor::Bq24195l::ChargeStatus::ChargeTerminaison:
-                    sbs::io::logger("End charge. ");
-                    break;
-                }
-            } else {
-                sbs::io::logger("No battery detected.");
-            }
-            sbs::io::loggerln(PowerManager.isPowerGood() ? " Good power" : "Bad power");
         }
+        sbs::io::log(sbs::io::Verbosity::Mute, " -- Power Status: ", vbus, charge,
+                     PowerManager.isPowerGood() ? " Good power" : "Bad power");
     }
-    sbs::time::delay(10000);
 }
+
+void sbs::setup() {
+    // the calibrations read from the devices are kept for the next start
+    sbs::io::calibration::setAutoSave(true);
+    ENV.init();
+    ENV.gerPTSensor().setCorrection(sbs::sensor::Lps22hb::Channel::Pressure, lpsPressureCorrection);
+    PowerManager.init();
+    bme.init();
+#ifdef ARDUINO_SAMD_MKRWIFI1010
+    pinMode(ADC_BATTERY, INPUT);
+#endif
+    //PowerManager.getSettings().setFastChargeCurrent(2.2);
+    //PowerManager.getSettings().setChargeVoltage(4.208);
+    //PowerManager.getSettings().battPreChargeToFastCharge = sbs::sensor::Bq24195l::Settings::BattPreChargeToFastCharge::V28;
+    //PowerManager.getSettings().dpdmDetection = sbs::sensor::Bq24195l::Settings::DPDMDetection::No;
+    //PowerManager.ApplySettings();
+    auto& scheduler = sbs::time::scheduler();
+    scheduler.addPeriodic("housekeeping", 1000, &housekeepingTask, nullptr, 1);
+    auto environment = scheduler.addPeriodic("environment", 10000, &environmentTask);
+    scheduler.setEnabled(environment, false);
+    scheduler.addPeriodic("power", 10000, &powerTask);
+    scheduler.setIdleHook(&sbs::time::idleSleep);
+    housekeepingClient = sbs::time::watchdog().add("housekeeping", 5000);
+    sbs::time::watchdog().start();
+}
+
+void sbs::loop() {}
@@ -0,0 +1,72 @@
+/**
+ * @file binarylog_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/BinaryLog.h>
+
+void binarylog_text_test() {
+    // FNV-1a reference values
+    static_assert(sbs::io::formatId("") == 2166136261UL, "bad format id");
+    static_assert(sbs::io::formatId("a") == 0xE40C292CUL, "bad format id");
+    sbs::io::setBinaryLog(false);
+    sbs::io::setVerbosity(sbs::io::Verbosity::Warning);
+    SBS_START_REDIRECT_OUT
+    SBS_BLOG(sbs::io::Verbosity::Error, "T={.1} n={} h={x}", 21.55, static_cast<int32_t>(-3), static_cast<uint8_t>(0xAB));
+    SBS_BLOG(sbs::io::Verbosity::Warning, "{} and {b}", "str", static_cast<uint8_t>(5), 7U);
+    SBS_BLOG(sbs::io::Verbosity::Debug, "hidden {}", 1);
+    SBS_BLOG(sbs::io::Verbosity::Mute, "no placeholder");
+    SBS_TEST_OUT("ERROR T=21.6 n=-3 h=AB\nWARNING str and 00000101 7\nno placeholder\n");
+    SBS_END_REDIRECT_OUT
+}
+
+void binarylog_record_test() {
+#ifdef NATIVE
+    sbs::io::setVerbosity(sbs::io::Verbosity::Debug);
+    sbs::io::setBinaryLog(true);
+    SBS_START_REDIRECT_OUT
+    SBS_BLOG(sbs::io::Verbosity::Debug, "v={} s={}", static_cast<int16_t>(-2), "ab");
+    sbs::io::flushLog();
+    std::string raw = testHelper::output();
+    SBS_END_REDIRECT_OUT
+    sbs::io::setBinaryLog(false);
+    // header + 2 arguments (3 and 4 bytes) + checksum
+    TEST_ASSERT_EQUAL(sbs::io::LogRecord::headerSize + 7 + 1, raw.size());
+    const auto* record = reinterpret_cast<const uint8_t*>(raw.data());
+    TEST_ASSERT_EQUAL(sbs::io::LogRecord::sync, record[0]);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(sbs::io::Verbosity::Debug), record[1]);
+    uint32_t id = 0;
+    memcpy(&id, record + 2, 4);
+    TEST_ASSERT_EQUAL_UINT32(sbs::io::formatId("v={} s={}"), id);
+    TEST_ASSERT_EQUAL(7, record[6]);
+    TEST_ASSERT_EQUAL(sbs::io::LogRecord::kindSigned | 2, record[7]);
+    TEST_ASSERT_EQUAL(sbs::io::LogRecord::kindString, record[10]);
+    uint8_t sum = 0;
+    for (size_t i = 1; i + 1 < raw.size(); ++i)
+        sum = static_cast<uint8_t>(sum + record[i]);
+    TEST_ASSERT_EQUAL(sum, record[raw.size() - 1]);
+    // decoding on the device gives the text output
+    SBS_START_REDIRECT_OUT
+    sbs::io::printRecord(record, "v={} s={}");
+    sbs::io::printRecord(record, nullptr);
+    SBS_TEST_OUT("DEBUG v=-2 s=ab\nDEBUG #F5DCD4B0 -2 ab\n");
+    SBS_END_REDIRECT_OUT
+    // too many arguments: record is flagged
+    sbs::io::LogRecord big(sbs::io::Verbosity::Error, 0);
+    for (uint8_t i = 0; i < SBS_BLOG_PAYLOAD_SIZE; ++i)
+        big.add(static_cast<uint32_t>(i));
+    TEST_ASSERT_TRUE(big.close() <= sbs::io::LogRecord::headerSize + SBS_BLOG_PAYLOAD_SIZE + 1);
+    TEST_ASSERT_TRUE((big.data()[1] & sbs::io::LogRecord::truncated) != 0);
+    // the arguments after the truncated one are dropped, even the ones that would fit
+    const uint8_t bigSize = big.close();
+    big.add(static_cast<uint8_t>(1));
+    big.add("x");
+    TEST_ASSERT_EQUAL(bigSize, big.close());
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+#endif
+}
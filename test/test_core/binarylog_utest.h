@@ -0,0 +1,12 @@
+/**
+ * @file binarylog_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void binarylog_text_test();
+void binarylog_record_test();
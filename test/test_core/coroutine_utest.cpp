@@ -0,0 +1,69 @@
+/**
+ * @file coroutine_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <core/Coroutine.h>
+
+/**
+ * @brief Test sequence: step, yield, wait for a flag, delay, step
+ */
+class Sequence {
+public:
+    uint8_t steps = 0;    ///< Number of steps done
+    bool ready    = false;///< Flag waited by the sequence
+
+    /**
+     * @brief Run the sequence
+     * @return True when complete
+     */
+    bool run() {
+        SBS_CO_BEGIN(co);
+        ++steps;
+        SBS_CO_YIELD(co);
+        ++steps;
+        SBS_CO_WAIT_UNTIL(co, ready);
+        ++steps;
+        SBS_CO_DELAY(co, 5);
+        ++steps;
+        SBS_CO_END(co);
+    }
+
+    /// Coroutine state
+    sbs::Coroutine co;
+};
+
+void coroutine_test() {
+    Sequence sequence;
+    TEST_ASSERT_FALSE(sequence.co.isRunning());
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_EQUAL(1, sequence.steps);
+    TEST_ASSERT_TRUE(sequence.co.isRunning());
+    // waits for the flag
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_EQUAL(2, sequence.steps);
+    sequence.ready = true;
+    // waits for the delay
+    auto start = sbs::time::millis();
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_EQUAL(3, sequence.steps);
+    TEST_ASSERT_UINT32_WITHIN(5, 5, sequence.co.remainingDelay());
+    uint16_t calls = 1;
+    while (!sequence.run())
+        ++calls;
+    TEST_ASSERT_TRUE(sbs::time::millis() - start >= 5);
+    TEST_ASSERT_TRUE(calls > 1);
+    TEST_ASSERT_EQUAL(4, sequence.steps);
+    TEST_ASSERT_FALSE(sequence.co.isRunning());
+    // complete: the next call starts again
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_EQUAL(5, sequence.steps);
+    sequence.co.reset();
+    TEST_ASSERT_FALSE(sequence.run());
+    TEST_ASSERT_EQUAL(6, sequence.steps);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file eventloop_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <core/EventLoop.h>
+#ifdef NATIVE
+#include <core/Node.h>
+#include <net/Wifi.h>
+#include <thread>
+#include <time/timing.h>
+#endif
+
+/// Sum of the handled values
+static uint32_t handledSum = 0;
+
+/**
+ * @brief Handler adding the event value
+ * @param event The event
+ * @param context Number of handled events
+ */
+static void addValue(const sbs::Event& event, void* context) {
+    handledSum += event.value + event.data;
+    ++*static_cast<uint8_t*>(context);
+}
+
+/**
+ * @brief Source posting one event
+ */
+static void oneShotSource() {
+    static bool done = false;
+    if (!done) sbs::events().post(sbs::SystemEvent::User + 1, 7);
+    done = true;
+}
+
+void eventloop_test() {
+    static sbs::EventLoop loop;
+    constexpr sbs::EventType sample = sbs::SystemEvent::User;
+    uint8_t handled                 = 0;
+    handledSum                      = 0;
+    TEST_ASSERT_TRUE(loop.setHandler(sample, &addValue, &handled));
+    TEST_ASSERT_FALSE(loop.setHandler(sbs::EventLoop::maxTypes, &addValue));
+    TEST_ASSERT_FALSE(loop.pending());
+    TEST_ASSERT_EQUAL(0, loop.dispatch());
+    TEST_ASSERT_TRUE(loop.post(sample, 1, 10));
+    TEST_ASSERT_TRUE(loop.post(sample, 2, 20));
+    TEST_ASSERT_TRUE(loop.pending());
+    TEST_ASSERT_EQUAL(2, loop.dispatch());
+    TEST_ASSERT_EQUAL(2, handled);
+    TEST_ASSERT_EQUAL_UINT32(33, handledSum);
+    TEST_ASSERT_EQUAL_UINT32(2, loop.getCount(sample));
+    TEST_ASSERT_TRUE(loop.getMeanLatency(sample) <= loop.getMaxLatency(sample));
+    // full queue
+    for (uint16_t i = 0; i < sbs::EventQueue::capacity; ++i)
+        TEST_ASSERT_TRUE(loop.post(sample));
+    TEST_ASSERT_FALSE(loop.post(sample));
+    TEST_ASSERT_EQUAL_UINT32(1, loop.getDropped());
+    TEST_ASSERT_EQUAL(sbs::EventQueue::capacity, loop.dispatch());
+    TEST_ASSERT_FALSE(loop.pending());
+    // events without handler are counted and ignored
+    TEST_ASSERT_TRUE(loop.post(sbs::SystemEvent::SerialRx));
+    TEST_ASSERT_EQUAL(1, loop.dispatch());
+    TEST_ASSERT_EQUAL_UINT32(1, loop.getCount(sbs::SystemEvent::SerialRx));
+    loop.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, loop.getCount(sample));
+    // polled sources post in the main event loop
+    TEST_ASSERT_TRUE(sbs::events().addSource(&oneShotSource));
+    sbs::events().poll();
+    sbs::events().poll();
+    TEST_ASSERT_EQUAL(1, sbs::events().dispatch());
+    // a timer callback posts its event type
+    sbs::EventLoop::timerEvent(sbs::EventLoop::typeContext(sbs::SystemEvent::User + 2));
+    TEST_ASSERT_EQUAL(1, sbs::events().dispatch());
+    TEST_ASSERT_EQUAL_UINT32(1, sbs::events().getCount(sbs::SystemEvent::User + 2));
+}
+
+void eventqueue_thread_test() {
+#ifdef NATIVE
+    // several producers against one consumer: no event lost nor duplicated
+    static sbs::EventQueue queue;
+    constexpr uint16_t perProducer = 20000;
+    constexpr uint8_t producers    = 4;
+    auto produce                   = [](uint8_t id) {
+        for (uint16_t i = 0; i < perProducer;) {
+            sbs::Event event;
+            event.type  = id;
+            event.value = i;
+            if (queue.push(event)) ++i;
+        }
+    };
+    std::thread threads[producers];
+    for (uint8_t id = 0; id < producers; ++id)
+        threads[id] = std::thread(produce, id);
+    uint16_t next[producers] = {};
+    uint32_t received        = 0;
+    bool ordered             = true;
+    while (received < static_cast<uint32_t>(perProducer) * producers) {
+        sbs::Event event;
+        if (!queue.pop(event)) continue;
+        // each producer's events come in order
+        if (event.value != next[event.type]) ordered = false;
+        next[event.type] = event.value + 1;
+        ++received;
+    }
+    for (auto& thread : threads)
+        thread.join();
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(queue.empty());
+#endif
+}
+
+#ifdef NATIVE
+/// Value of the last network event
+static uint16_t networkStatus = 0;
+
+/**
+ * @brief Handler keeping the network status
+ * @param event The event
+ */
+static void keepStatus(const sbs::Event& event, void*) {
+    networkStatus = event.value;
+}
+#endif
+
+void eventloop_network_test() {
+#ifdef NATIVE
+    // a node of its own: fresh event loop, virtual clock and emulated WiFi
+    sbs::Node node{nullptr, nullptr};
+    const sbs::NodeScope scope{node};
+    sbs::time::setVirtualTime(true);
+    sbs::time::setTime(0);
+    sbs::events().setHandler(sbs::SystemEvent::Network, &keepStatus);
+    sbs::net::Wifi::get().init("ssid", "pass");
+    fakeWifiSetStatus(3);
+    // the status is checked once per poll period
+    sbs::events().poll();
+    TEST_ASSERT_FALSE(sbs::events().pending());
+    sbs::time::advance(SBS_WIFI_POLL_PERIOD * 1000ULL);
+    sbs::events().poll();
+    TEST_ASSERT_EQUAL(1, sbs::events().dispatch());
+    TEST_ASSERT_EQUAL_UINT32(1, sbs::events().getCount(sbs::SystemEvent::Network));
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(sbs::net::Wifi::Status::ClientConnected), networkStatus);
+    // no event while the status stays the same
+    sbs::time::advance(SBS_WIFI_POLL_PERIOD * 1000ULL);
+    sbs::events().poll();
+    TEST_ASSERT_FALSE(sbs::events().pending());
+    // a lost connection
+    fakeWifiSetStatus(0);
+    sbs::time::advance(SBS_WIFI_POLL_PERIOD * 1000ULL);
+    sbs::events().poll();
+    TEST_ASSERT_EQUAL(1, sbs::events().dispatch());
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(sbs::net::Wifi::Status::Disconnected), networkStatus);
+#endif
+}
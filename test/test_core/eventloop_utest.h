@@ -0,0 +1,13 @@
+/**
+ * @file eventloop_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void eventloop_test();
+void eventloop_network_test();
+void eventqueue_thread_test();
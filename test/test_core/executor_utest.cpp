@@ -0,0 +1,63 @@
+/**
+ * @file executor_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <core/Executor.h>
+#ifdef NATIVE
+#include <atomic>
+#include <vector>
+#endif
+
+void executor_test() {
+#ifdef NATIVE
+    sbs::Executor pool{4};
+    TEST_ASSERT_EQUAL_UINT32(4, pool.getThreadCount());
+    // each index handled once, by parts no larger than the grain
+    constexpr size_t count = 100000;
+    std::vector<uint8_t> visits(count, 0);
+    std::atomic<bool> oversized{false};
+    pool.parallelFor(0, count, 100, [&](size_t first, size_t last) {
+        if (last - first > 100) oversized = true;
+        for (size_t i = first; i < last; ++i)
+            ++visits[i];
+    });
+    TEST_ASSERT_FALSE(oversized);
+    bool once = true;
+    for (const uint8_t visit : visits)
+        once = once && visit == 1;
+    TEST_ASSERT_TRUE(once);
+
+    // nested ranges: the tasks wait for their own parts without blocking the pool
+    std::atomic<uint64_t> sum{0};
+    pool.parallelFor(0, 16, 1, [&](size_t first, size_t last) {
+        for (size_t outer = first; outer < last; ++outer) {
+            pool.parallelFor(0, 1000, 10, [&](size_t begin, size_t end) {
+                uint64_t partial = 0;
+                for (size_t i = begin; i < end; ++i)
+                    partial += i;
+                sum += partial;
+            });
+        }
+    });
+    TEST_ASSERT_EQUAL_UINT32(16U * 499500U, sum.load());
+
+    // plain tasks, run before the end of the pool
+    std::atomic<uint32_t> done{0};
+    {
+        sbs::Executor local{2};
+        for (uint32_t i = 0; i < 50; ++i)
+            local.submit([&done]() { ++done; });
+    }
+    TEST_ASSERT_EQUAL_UINT32(50, done.load());
+
+    // empty range and the shared executor
+    pool.parallelFor(5, 5, 1, [&](size_t, size_t) { oversized = true; });
+    TEST_ASSERT_FALSE(oversized);
+    TEST_ASSERT_TRUE(sbs::executor().getThreadCount() >= 1);
+#endif
+}
@@ -0,0 +1,108 @@
+/**
+ * @file flashlog_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/Print.h>
+#include <io/FlashLog.h>
+#ifdef NATIVE
+#include <cstdio>
+#endif
+
+#ifdef NATIVE
+/// Content read from the flash log
+static std::string content;
+
+/**
+ * @brief Collect the flash log content
+ * @param data The data
+ * @param size The data size
+ */
+static void collect(const uint8_t* data, uint16_t size) {
+    content.append(reinterpret_cast<const char*>(data), size);
+}
+
+/**
+ * @brief Read the whole flash log
+ * @return The content
+ */
+static std::string readAll() {
+    content.clear();
+    sbs::io::flashlog::read(&collect);
+    return content;
+}
+#endif
+
+void flashlog_test() {
+#ifdef NATIVE
+    TEST_ASSERT_TRUE(sbs::io::flashlog::format());
+    TEST_ASSERT_EQUAL_UINT32(0, sbs::io::flashlog::size());
+    // log lines are recorded
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    sbs::io::flashlog::attach(true);
+    SBS_START_REDIRECT_OUT
+    sbs::io::loggerln("first line");
+    sbs::io::errorln("second line");
+    SBS_END_REDIRECT_OUT
+    sbs::io::flashlog::attach(false);
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\n", readAll().c_str());
+    // only the synchronized data survives a restart
+    TEST_ASSERT_TRUE(sbs::io::flashlog::sync());
+    const uint8_t more[] = {'a', 'b'};
+    sbs::io::flashlog::append(more, 2);
+    TEST_ASSERT_TRUE(sbs::io::flashlog::begin());
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\n", readAll().c_str());
+    // and writing continues after it
+    sbs::io::flashlog::append(more, 2);
+    sbs::io::flashlog::sync();
+    TEST_ASSERT_TRUE(sbs::io::flashlog::begin());
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\nab", readAll().c_str());
+    // dump
+    sbs::io::CaptureSink capture;
+    sbs::io::flashlog::dump(capture);
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\nab", capture.str().c_str());
+    // a page cut by a reset is ignored, the writing goes on in the next file
+    FILE* file = fopen((std::string(SBS_FLASHLOG_PREFIX) + "0.bin").c_str(), "ab");
+    TEST_ASSERT_NOT_NULL(file);
+    fwrite(more, 1, 2, file);
+    fclose(file);
+    TEST_ASSERT_TRUE(sbs::io::flashlog::begin());
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\nab", readAll().c_str());
+    sbs::io::flashlog::append(more, 2);
+    sbs::io::flashlog::sync();
+    TEST_ASSERT_TRUE(sbs::io::flashlog::begin());
+    TEST_ASSERT_EQUAL_STRING("first line\nERROR second line\nabab", readAll().c_str());
+#endif
+}
+
+void flashlog_rotation_test() {
+#ifdef NATIVE
+    TEST_ASSERT_TRUE(sbs::io::flashlog::format());
+    // write more than the whole ring
+    constexpr uint32_t total = SBS_FLASHLOG_FILES * SBS_FLASHLOG_FILE_SIZE * 3 / 2;
+    std::string written;
+    char record[16];
+    for (uint32_t i = 0; written.size() < total; ++i) {
+        int size = snprintf(record, sizeof(record), "%08u\n", i);
+        sbs::io::flashlog::append(reinterpret_cast<const uint8_t*>(record), static_cast<uint16_t>(size));
+        written.append(record, static_cast<size_t>(size));
+    }
+    sbs::io::flashlog::sync();
+    std::string kept = readAll();
+    // the oldest data is lost, the newest is kept in order
+    TEST_ASSERT_TRUE(kept.size() < SBS_FLASHLOG_FILES * SBS_FLASHLOG_FILE_SIZE);
+    TEST_ASSERT_TRUE(kept.size() > (SBS_FLASHLOG_FILES - 1) * (SBS_FLASHLOG_FILE_SIZE - SBS_FLASHLOG_PAGE_SIZE));
+    TEST_ASSERT_TRUE(written.compare(written.size() - kept.size(), kept.size(), kept) == 0);
+    TEST_ASSERT_EQUAL_UINT32(kept.size(), sbs::io::flashlog::size());
+    // same content after a restart
+    TEST_ASSERT_TRUE(sbs::io::flashlog::begin());
+    TEST_ASSERT_TRUE(kept == readAll());
+    for (char index = '0'; index < '0' + SBS_FLASHLOG_FILES; ++index)
+        std::remove((std::string(SBS_FLASHLOG_PREFIX) + index + ".bin").c_str());
+#endif
+}
@@ -0,0 +1,176 @@
+/**
+ * @file format_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/Format.h>
+#include <core/LogLine.h>
+#if defined(NATIVE) && defined(SBS_BENCHMARK)
+#include <chrono>
+#endif
+
+/**
+ * @brief Compare a formatted text
+ * @param expected Expected text
+ * @param buffer Formatted text
+ * @param size Formatted size
+ */
+static void checkFormat(const char* expected, const char* buffer, uint8_t size) {
+    TEST_ASSERT_EQUAL(strlen(expected), size);
+    TEST_ASSERT_EQUAL_STRING_LEN(expected, buffer, size);
+}
+
+void format_test() {
+    char buffer[sbs::io::format::maxFormatSize];
+    using namespace sbs::io::format;
+    checkFormat("0", buffer, toDecimal(buffer, static_cast<uint64_t>(0)));
+    checkFormat("7", buffer, toDecimal(buffer, static_cast<uint64_t>(7)));
+    checkFormat("10", buffer, toDecimal(buffer, static_cast<uint64_t>(10)));
+    checkFormat("4294967295", buffer, toDecimal(buffer, static_cast<uint64_t>(4294967295ULL)));
+    checkFormat("4294967296", buffer, toDecimal(buffer, static_cast<uint64_t>(4294967296ULL)));
+    checkFormat("1000000000000000001", buffer, toDecimal(buffer, static_cast<uint64_t>(1000000000000000001ULL)));
+    checkFormat("18446744073709551615", buffer, toDecimal(buffer, static_cast<uint64_t>(-1)));
+    checkFormat("-9223372036854775808", buffer, toDecimal(buffer, static_cast<int64_t>(-9223372036854775807LL - 1)));
+    checkFormat("-12", buffer, toDecimal(buffer, static_cast<int64_t>(-12)));
+    checkFormat("00AF", buffer, toHexadecimal(buffer, 0xAF, 2));
+    checkFormat("FEDCBA9876543210", buffer, toHexadecimal(buffer, 0xFEDCBA9876543210ULL, 8));
+    checkFormat("00000101", buffer, toBinary(buffer, 5, 1));
+    checkFormat("1000000000000001", buffer, toBinary(buffer, 0x8001, 2));
+    checkFormat("2.00", buffer, toFixed(buffer, 1.999, 2));
+    checkFormat("-0.5", buffer, toFixed(buffer, -0.5, 1));
+    checkFormat("0.05", buffer, toFixed(buffer, 0.05, 2));
+    checkFormat("10", buffer, toFixed(buffer, 10.0, 0));
+    checkFormat("1013.3", buffer, toFixed(buffer, 1013.26, 1));
+    checkFormat("3.14159265", buffer, toFixed(buffer, 3.14159265358979, 8));
+    checkFormat("0.10000000000000000000", buffer, toFixed(buffer, 0.1, 20));
+    checkFormat("4294967040.0", buffer, toFixed(buffer, 4294967040.0, 1));
+    checkFormat("ovf", buffer, toFixed(buffer, -1e35, 2));
+    checkFormat("nan", buffer, toFixed(buffer, __builtin_nan(""), 2));
+    checkFormat("inf", buffer, toFixed(buffer, __builtin_inf(), 2));
+    // 64 bits integers are no longer truncated by Print
+    SBS_START_REDIRECT_OUT
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    sbs::io::loggerln(static_cast<uint64_t>(12345678901234ULL));
+    sbs::io::loggerln(static_cast<int64_t>(-12345678901234LL));
+    SBS_TEST_OUT("12345678901234\n-12345678901234\n");
+    SBS_END_REDIRECT_OUT
+}
+
+#ifdef NATIVE
+#ifdef SBS_BENCHMARK
+/**
+ * @brief Former formatting of a double: one digit per iteration, with float multiplications
+ * @param buffer Output buffer
+ * @param data The value
+ * @param digit Number of decimals
+ * @return Number of characters
+ */
+static uint8_t legacyFixed(char* buffer, double data, uint8_t digit) {
+    uint8_t count = 0;
+    if (data < 0.0) {
+        buffer[count++] = '-';
+        data            = -data;
+    }
+    double rounding = 0.5;
+    for (uint8_t i = 0; i < digit; ++i)
+        rounding /= 10.0;
+    data += rounding;
+    auto intPart     = static_cast<uint32_t>(data);
+    double remainder = data - static_cast<double>(intPart);
+    char digits[10];
+    uint8_t size = 0;
+    do {
+        digits[size++] = static_cast<char>('0' + intPart % 10);
+        intPart /= 10;
+    } while (intPart != 0);
+    while (size > 0)
+        buffer[count++] = digits[--size];
+    if (digit > 0)
+        buffer[count++] = '.';
+    while (digit-- > 0) {
+        remainder *= 10.0;
+        auto toPrint    = static_cast<unsigned int>(remainder);
+        buffer[count++] = static_cast<char>('0' + toPrint);
+        remainder -= toPrint;
+    }
+    return count;
+}
+#endif
+
+/**
+ * @brief Former formatting of an integer: one digit per division
+ * @param buffer Output buffer
+ * @param data The value
+ * @return Number of characters
+ */
+static uint8_t legacyDecimal(char* buffer, int32_t data) {
+    uint8_t count = 0;
+    if (data >= 0)
+        data = -data;
+    else
+        buffer[count++] = '-';
+    char digits[10];
+    uint8_t size = 0;
+    do {
+        digits[size++] = static_cast<char>('0' - data % 10);
+        data /= 10;
+    } while (data != 0);
+    while (size > 0)
+        buffer[count++] = digits[--size];
+    return count;
+}
+
+#ifdef SBS_BENCHMARK
+/**
+ * @brief Time a formatting function
+ * @tparam Function Type of the function
+ * @param function The function, called with the iteration index
+ * @return Nanoseconds per call
+ */
+template<class Function>
+static double measure(Function function) {
+    constexpr uint32_t iterations = 200000;
+    volatile uint32_t sink        = 0;
+    auto start                    = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+        sink = sink + function(i);
+    auto duration = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / iterations;
+}
+#endif
+#endif
+
+void format_legacy_test() {
+#ifdef NATIVE
+    char buffer[sbs::io::format::maxFormatSize];
+    // both implementations agree where the former one was correct
+    for (int32_t i = -100000; i < 100000; i += 7) {
+        char legacy[sbs::io::format::maxFormatSize];
+        uint8_t size = legacyDecimal(legacy, i * 1013);
+        checkFormat(std::string(legacy, size).c_str(), buffer, sbs::io::format::toDecimal(buffer, static_cast<int64_t>(i * 1013)));
+    }
+#endif
+}
+
+void format_benchmark() {
+#if defined(NATIVE) && defined(SBS_BENCHMARK)
+    // opt-in (build flag -D SBS_BENCHMARK): the timings depend on the host load
+    char buffer[sbs::io::format::maxFormatSize];
+    double legacyInt   = measure([&](uint32_t i) { return legacyDecimal(buffer, static_cast<int32_t>(i * 2654435761UL)); });
+    double engineInt   = measure([&](uint32_t i) { return sbs::io::format::toDecimal(buffer, static_cast<int64_t>(static_cast<int32_t>(i * 2654435761UL))); });
+    double legacyFloat = measure([&](uint32_t i) { return legacyFixed(buffer, i * 0.0137 - 1000.0, 6); });
+    double engineFloat = measure([&](uint32_t i) { return sbs::io::format::toFixed(buffer, i * 0.0137 - 1000.0, 6); });
+    const auto verbosity = sbs::io::getVerbosity();
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    sbs::io::log(sbs::io::Verbosity::Mute, "format benchmark (ns/call):", sbs::io::field("int.legacy", legacyInt),
+                 sbs::io::field("int.engine", engineInt), sbs::io::field("fixed.legacy", legacyFloat),
+                 sbs::io::field("fixed.engine", engineFloat));
+    sbs::io::flushLog();
+    sbs::io::setVerbosity(verbosity);
+#endif
+}
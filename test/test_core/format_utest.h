@@ -0,0 +1,13 @@
+/**
+ * @file format_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void format_test();
+void format_legacy_test();
+void format_benchmark();
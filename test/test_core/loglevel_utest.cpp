@@ -0,0 +1,48 @@
+/**
+ * @file loglevel_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+// this translation unit only keeps warnings and errors
+#define SBS_LOG_LOCAL_LEVEL SBS_LOG_LEVEL_WARNING
+
+#include "../test_helper.h"
+
+#include <core/BinaryLog.h>
+
+/// Number of evaluated arguments
+static int evaluated = 0;
+
+/**
+ * @brief Argument with side effect
+ * @return The argument value
+ */
+static int32_t argument() {
+    ++evaluated;
+    return 42;
+}
+
+void loglevel_test() {
+    sbs::io::setVerbosity(sbs::io::Verbosity::Debug);
+    SBS_START_REDIRECT_OUT
+    SBS_DEBUG(argument());
+    SBS_DEBUGLN(argument());
+    SBS_BLOG(sbs::io::Verbosity::Debug, "{}", argument());
+    TEST_ASSERT_EQUAL(0, evaluated);
+    SBS_WARNING(argument());
+    SBS_WARNINGLN();
+    SBS_ERRORLN("e");
+    SBS_BLOG(sbs::io::Verbosity::Warning, "b={}", argument());
+    SBS_LOGLN("l");
+    TEST_ASSERT_EQUAL(2, evaluated);
+    SBS_TEST_OUT("WARNING 42\nERROR e\nWARNING b=42\nl\n");
+    // the runtime filter still applies to enabled levels
+    SBS_RESET_OUT
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    SBS_WARNINGLN("w");
+    SBS_TEST_OUT("");
+    SBS_END_REDIRECT_OUT
+}
@@ -0,0 +1,11 @@
+/**
+ * @file loglevel_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void loglevel_test();
@@ -0,0 +1,34 @@
+/**
+ * @file logline_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/LogLine.h>
+
+void logline_test() {
+    using sbs::io::field;
+    sbs::io::setVerbosity(sbs::io::Verbosity::Warning);
+    SBS_START_REDIRECT_OUT
+    sbs::io::log(sbs::io::Verbosity::Mute, "ENV:", field("T", 21.456), field("P", sbs::io::fixed(1013.26, 1)), field("ok", true));
+    sbs::io::log(sbs::io::Verbosity::Warning, "reg ", sbs::io::hex(static_cast<uint16_t>(0xBEEF)), ' ', sbs::io::bin(static_cast<uint8_t>(3)), ' ', -5, ' ', 7U, ' ', 2.5f);
+    sbs::io::log(sbs::io::Verbosity::Debug, "hidden");
+    sbs::io::log(sbs::io::Verbosity::Error, field("id", static_cast<uint64_t>(12345678901234ULL)), field("name", sbs::string{"node"}));
+    SBS_TEST_OUT("ENV: T=21.46 P=1013.3 ok=true\nWARNING reg BEEF 00000011 -5 7 2.50\nERROR id=12345678901234 name=node\n");
+#ifdef NATIVE
+    // too long line is cut
+    SBS_RESET_OUT
+    char longText[SBS_LOG_LINE_SIZE + 1];
+    memset(longText, 'a', SBS_LOG_LINE_SIZE);
+    longText[SBS_LOG_LINE_SIZE] = '\0';
+    sbs::io::log(sbs::io::Verbosity::Mute, longText);
+    std::string expected(SBS_LOG_LINE_SIZE - 3, 'a');
+    SBS_TEST_OUT((expected + "...\n").c_str());
+#endif
+    SBS_END_REDIRECT_OUT
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+}
@@ -0,0 +1,188 @@
+/**
+ * @file logsink_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/LogSink.h>
+#include <core/Print.h>
+
+#ifdef NATIVE
+/**
+ * @brief Buffered sink on a device with a controllable room
+ */
+class FakeDeviceSink : public sbs::io::BufferedSink {
+public:
+    std::string written;   ///< What reached the device
+    uint16_t room = 0xFFFF;///< Bytes the device accepts before blocking
+
+protected:
+    uint16_t deviceRoom(uint16_t wanted) override { return wanted < room ? wanted : room; }
+    void deviceWrite(const uint8_t* data, uint16_t size) override {
+        written.append(reinterpret_cast<const char*>(data), size);
+        room = room > size ? room - size : 0;
+    }
+};
+
+/// Output of the callback sink
+static std::string callbackOutput;
+
+/**
+ * @brief Callback of the callback sink
+ * @param data The output
+ * @param size Output size
+ */
+static void callback(const uint8_t* data, uint16_t size) {
+    callbackOutput.append(reinterpret_cast<const char*>(data), size);
+}
+
+/// Output of the memory sink
+static std::string memoryOutput;
+
+/**
+ * @brief Read the memory sink
+ * @param data The output
+ * @param size Output size
+ */
+static void readMemory(const uint8_t* data, uint16_t size) {
+    memoryOutput.append(reinterpret_cast<const char*>(data), size);
+}
+#endif
+
+void logsink_buffered_test() {
+#ifdef NATIVE
+    sbs::io::setLogMode(sbs::io::LogMode::Buffered);
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    SBS_START_REDIRECT_OUT
+    // incomplete line stays in the line buffer
+    sbs::io::logger("abc");
+    TEST_ASSERT_EQUAL_STRING("", testHelper::capture.str().c_str());
+    // complete line goes to the sinks
+    sbs::io::loggerln(static_cast<int32_t>(-42));
+    TEST_ASSERT_EQUAL_STRING("abc-42\n", testHelper::capture.str().c_str());
+    // flush pushes the incomplete line
+    sbs::io::logger("def");
+    SBS_TEST_OUT("abc-42\ndef");
+    SBS_END_REDIRECT_OUT
+#endif
+}
+
+void logsink_drop_test() {
+#ifdef NATIVE
+    sbs::io::setLogMode(sbs::io::LogMode::Buffered);
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    static FakeDeviceSink device;
+    SBS_START_REDIRECT_OUT
+    sbs::io::addSink(device);
+    device.setHold(true);
+    // fill the ring with 10-char lines
+    constexpr uint16_t lines = SBS_LOG_BUFFER_SIZE / 10;
+    for (uint16_t i = 0; i < lines; ++i)
+        sbs::io::loggerln("123456789");
+    TEST_ASSERT_EQUAL_STRING("", device.written.c_str());
+    TEST_ASSERT_EQUAL_UINT16(lines * 10, device.getPending());
+    // no room left: the new lines are dropped, not the old ones
+    sbs::io::loggerln("123456789");
+    sbs::io::loggerln("123456789");
+    TEST_ASSERT_EQUAL_UINT32(2, device.getDropped());
+    TEST_ASSERT_EQUAL_UINT16(lines * 10, device.getPending());
+    // other sinks are not affected
+    TEST_ASSERT_EQUAL_UINT32((lines + 2) * 10, testHelper::capture.str().size());
+    // once drained, the loss is reported before the next line
+    device.setHold(false);
+    TEST_ASSERT_EQUAL_UINT16(0, device.getPending());
+    device.written.clear();
+    sbs::io::loggerln("next");
+    TEST_ASSERT_EQUAL_STRING("[dropped 2]\nnext\n", device.written.c_str());
+    // a slow device only gets what it can take without blocking
+    device.written.clear();
+    device.room = 4;
+    sbs::io::loggerln("abcdefgh");
+    TEST_ASSERT_EQUAL_STRING("abcd", device.written.c_str());
+    TEST_ASSERT_EQUAL_UINT16(5, device.getPending());
+    device.room = 2;
+    sbs::io::drainLog();
+    TEST_ASSERT_EQUAL_STRING("abcdef", device.written.c_str());
+    sbs::io::flushLog();
+    TEST_ASSERT_EQUAL_STRING("abcdefgh\n", device.written.c_str());
+    // an over-long line is split by the line buffer, not lost
+    SBS_RESET_OUT
+    char longLine[SBS_LOG_LINE_SIZE + 11];
+    for (uint16_t i = 0; i < SBS_LOG_LINE_SIZE + 10; ++i)
+        longLine[i] = static_cast<char>('a' + i % 26);
+    longLine[SBS_LOG_LINE_SIZE + 10] = '\0';
+    sbs::io::loggerln(longLine);
+    SBS_TEST_OUT((std::string(longLine) + "\n").c_str());
+    sbs::io::removeSink(device);
+    SBS_END_REDIRECT_OUT
+    TEST_ASSERT_EQUAL_UINT32(2, device.getDropped());
+#endif
+}
+
+void logsink_direct_test() {
+#ifdef NATIVE
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    SBS_START_REDIRECT_OUT
+    sbs::io::setLogMode(sbs::io::LogMode::Direct);
+    TEST_ASSERT_TRUE(sbs::io::getLogMode() == sbs::io::LogMode::Direct);
+    TEST_ASSERT_TRUE(sbs::io::serialSink().getMode() == sbs::io::LogMode::Direct);
+    sbs::io::logger("abc");
+    TEST_ASSERT_EQUAL_STRING("abc", testHelper::capture.str().c_str());
+    sbs::io::logger(static_cast<uint8_t>(5));
+    TEST_ASSERT_EQUAL_STRING("abc5", testHelper::capture.str().c_str());
+    sbs::io::setLogMode(sbs::io::LogMode::Buffered);
+    sbs::io::loggerln();
+    SBS_TEST_OUT("abc5\n");
+    SBS_END_REDIRECT_OUT
+#endif
+}
+
+void logsink_routing_test() {
+#ifdef NATIVE
+    sbs::io::setLogMode(sbs::io::LogMode::Buffered);
+    sbs::io::setVerbosity(sbs::io::Verbosity::Debug);
+    static sbs::io::CallbackSink network(&callback);
+    static sbs::io::MemorySink<16> memory;
+    callbackOutput.clear();
+    SBS_START_REDIRECT_OUT
+    TEST_ASSERT_TRUE(sbs::io::addSink(network));
+    TEST_ASSERT_FALSE(sbs::io::addSink(network));
+    TEST_ASSERT_TRUE(sbs::io::addSink(memory));
+    // no room for a fifth sink
+    static sbs::io::CaptureSink extra;
+    static sbs::io::CaptureSink tooMany;
+    TEST_ASSERT_TRUE(sbs::io::addSink(extra));
+    TEST_ASSERT_FALSE(sbs::io::addSink(tooMany));
+    sbs::io::removeSink(extra);
+    // each sink gets the lines up to its level
+    network.setLevel(sbs::io::Verbosity::Warning);
+    memory.setLevel(sbs::io::Verbosity::Error);
+    sbs::io::debugln("d");
+    sbs::io::warningln("w");
+    sbs::io::errorln("e");
+    sbs::io::loggerln("l");
+    SBS_TEST_OUT("DEBUG d\nWARNING w\nERROR e\nl\n");
+    TEST_ASSERT_EQUAL_STRING("WARNING w\nERROR e\nl\n", callbackOutput.c_str());
+    // the memory sink keeps the latest output
+    memoryOutput.clear();
+    memory.read(&readMemory);
+    TEST_ASSERT_EQUAL_STRING("ERROR e\nl\n", memoryOutput.c_str());
+    sbs::io::loggerln("123456789");
+    memoryOutput.clear();
+    memory.read(&readMemory);
+    TEST_ASSERT_EQUAL_UINT16(16, memory.size());
+    TEST_ASSERT_EQUAL_STRING("R e\nl\n123456789\n", memoryOutput.c_str());
+    // unregistered sinks get nothing
+    sbs::io::removeSink(network);
+    sbs::io::removeSink(memory);
+    callbackOutput.clear();
+    sbs::io::errorln("x");
+    TEST_ASSERT_EQUAL_STRING("", callbackOutput.c_str());
+    TEST_ASSERT_EQUAL_UINT16(16, memory.size());
+    SBS_END_REDIRECT_OUT
+#endif
+}
@@ -0,0 +1,14 @@
+/**
+ * @file logsink_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void logsink_buffered_test();
+void logsink_drop_test();
+void logsink_direct_test();
+void logsink_routing_test();
@@ -0,0 +1,91 @@
+/**
+ * @file logstamp_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+
+#include <core/BinaryLog.h>
+#include <core/LogLimiter.h>
+#include <time/timing.h>
+
+void logstamp_test() {
+#ifdef NATIVE
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    // sequence numbers
+    sbs::io::setLogStamp(sbs::io::LogStamp::Sequence);
+    uint16_t first = sbs::io::nextLogSequence() + 1;
+    SBS_START_REDIRECT_OUT
+    sbs::io::loggerln("a");
+    sbs::io::error("b");
+    sbs::io::errorln(static_cast<uint8_t>(1));
+    sbs::io::log(sbs::io::Verbosity::Mute, "c");
+    std::string expected = "#" + std::to_string(first) + " a\n#" + std::to_string(first + 1) + " ERROR b1\n#" + std::to_string(first + 2) + " c\n";
+    SBS_TEST_OUT(expected.c_str());
+    SBS_END_REDIRECT_OUT
+    // time stamps
+    sbs::io::setLogStamp(sbs::io::LogStamp::Time);
+    SBS_START_REDIRECT_OUT
+    sbs::io::loggerln("t");
+    sbs::io::flushLog();
+    std::string line = testHelper::output();
+    SBS_END_REDIRECT_OUT
+    TEST_ASSERT_EQUAL('[', line[0]);
+    size_t dot = line.find('.');
+    TEST_ASSERT_TRUE(dot != std::string::npos);
+    TEST_ASSERT_EQUAL_STRING("] t\n", line.substr(dot + 7).c_str());
+    // stamps in binary records
+    sbs::io::setLogStamp(sbs::io::LogStamp::Both);
+    sbs::io::setBinaryLog(true);
+    SBS_START_REDIRECT_OUT
+    SBS_BLOG(sbs::io::Verbosity::Error, "x={}", static_cast<uint8_t>(3));
+    sbs::io::flushLog();
+    std::string raw = testHelper::output();
+    SBS_END_REDIRECT_OUT
+    sbs::io::setBinaryLog(false);
+    sbs::io::setLogStamp(sbs::io::LogStamp::None);
+    const auto* record = reinterpret_cast<const uint8_t*>(raw.data());
+    TEST_ASSERT_EQUAL(sbs::io::LogRecord::timeStamped | sbs::io::LogRecord::sequenced | 1, record[1]);
+    TEST_ASSERT_EQUAL(10 + 2, record[6]);
+    uint16_t number;
+    memcpy(&number, record + sbs::io::LogRecord::headerSize + 8, 2);
+    TEST_ASSERT_EQUAL(first + 3, number);
+    SBS_START_REDIRECT_OUT
+    sbs::io::printRecord(record, "x={}");
+    SBS_TEST_OUT("ERROR x=3\n");
+    SBS_END_REDIRECT_OUT
+#endif
+}
+
+void loglimiter_test() {
+    sbs::io::setVerbosity(sbs::io::Verbosity::Warning);
+    SBS_START_REDIRECT_OUT
+    // deduplication only
+    sbs::io::LogLimiter dedup{0};
+    for (uint8_t i = 0; i < 4; ++i)
+        dedup.log(sbs::io::Verbosity::Warning, "flap");
+    TEST_ASSERT_EQUAL(3, dedup.getRepeated());
+    dedup.log(sbs::io::Verbosity::Warning, "other");
+    SBS_TEST_OUT("WARNING flap\nWARNING last message repeated 3 times\nWARNING other\n");
+    // rate limiting: one state per call site
+    SBS_RESET_OUT
+    for (uint8_t i = 0; i < 5; ++i)
+        SBS_LOG_LIMITED(50, sbs::io::Verbosity::Mute, "value=", i % 2);
+    sbs::time::delay(60);
+    SBS_LOG_LIMITED(50, sbs::io::Verbosity::Mute, "done");
+    SBS_TEST_OUT("value=0\ndone\n");
+    SBS_RESET_OUT
+    sbs::io::LogLimiter limiter{50};
+    for (uint8_t i = 0; i < 5; ++i)
+        limiter.log(sbs::io::Verbosity::Mute, "value=", i % 2);
+    TEST_ASSERT_EQUAL(2, limiter.getRepeated());
+    TEST_ASSERT_EQUAL(2, limiter.getSuppressed());
+    sbs::time::delay(60);
+    limiter.log(sbs::io::Verbosity::Mute, "value=", 0);
+    SBS_TEST_OUT("value=0\n4 messages suppressed\nvalue=0\n");
+    SBS_END_REDIRECT_OUT
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+}
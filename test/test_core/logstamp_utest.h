@@ -0,0 +1,12 @@
+/**
+ * @file logstamp_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void logstamp_test();
+void loglimiter_test();
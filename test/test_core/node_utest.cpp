@@ -0,0 +1,94 @@
+/**
+ * @file node_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <core/EventLoop.h>
+#include <core/Node.h>
+#include <core/Print.h>
+#include <io/CalibrationCache.h>
+#include <time/Sleep.h>
+#include <time/timing.h>
+#ifdef NATIVE
+#include <memory>
+#include <vector>
+
+/// Loop turns of each node
+static sbs::NodeLocal<uint32_t> turns;
+
+/**
+ * @brief Setup of the simulated nodes
+ */
+static void nodeSetup() {
+    sbs::time::setVirtualTime(true);
+    sbs::time::setTime(0);
+    const uint8_t blob = 0x5A;
+    sbs::io::calibration::store(0x77, 0x60, 1, &blob);
+}
+
+/**
+ * @brief Loop of the simulated nodes: 100 turns of 10 ms
+ */
+static void nodeLoop() {
+    sbs::time::delay(10);
+    if (++turns.get() < 100) return;
+    // the clock of the node is only moved by its own delays and sleeps
+    uint8_t blob = 0;
+    const bool cached = sbs::io::calibration::load(0x77, 0x60, 1, &blob) && blob == 0x5A;
+    sbs::setExecReturn(sbs::time::millis() >= 1000 && cached ? static_cast<int>(turns.get()) : -1);
+    sbs::killLoop();
+}
+#endif
+
+void node_test() {
+#ifdef NATIVE
+    constexpr uint32_t nodeCount = 64;
+    const auto verbosity         = sbs::io::getVerbosity();
+    const bool virtualTime       = sbs::time::isVirtualTime();
+    sbs::io::calibration::invalidate(0x77, 0x60);
+    std::vector<std::unique_ptr<sbs::Node>> nodes;
+    std::vector<sbs::Node*> pointers;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        nodes.emplace_back(new sbs::Node(&nodeSetup, &nodeLoop));
+        pointers.push_back(nodes.back().get());
+        // the nodes are quiet
+        const sbs::NodeScope scope{*nodes.back()};
+        sbs::io::setVerbosity(sbs::io::Verbosity::Mute);
+    }
+    TEST_ASSERT_FALSE(nodes.front()->isStarted());
+    sbs::runNodes(pointers.data(), nodeCount, 4);
+    for (const auto& node : nodes) {
+        TEST_ASSERT_TRUE(node->isStarted());
+        TEST_ASSERT_FALSE(node->isRunning());
+        TEST_ASSERT_EQUAL_INT32(100, node->getReturnCode());
+        TEST_ASSERT_FALSE(node->step());
+    }
+    // the main node kept its state
+    TEST_ASSERT_EQUAL_UINT32(0, turns.get());
+    TEST_ASSERT_TRUE(verbosity == sbs::io::getVerbosity());
+    TEST_ASSERT_EQUAL(virtualTime, sbs::time::isVirtualTime());
+    uint8_t blob = 0;
+    TEST_ASSERT_FALSE(sbs::io::calibration::load(0x77, 0x60, 1, &blob));
+    TEST_ASSERT_TRUE(&sbs::Node::main() == &sbs::Node::current());
+    // a post from the main node wakes the node owning the event loop
+    sbs::EventLoop* loop = nullptr;
+    {
+        const sbs::NodeScope scope{*nodes.front()};
+        loop = &sbs::events();
+        TEST_ASSERT_FALSE(sbs::time::sleep(0));
+    }
+    // the requests left by the previous tests
+    (void) sbs::time::sleep(0);
+    TEST_ASSERT_TRUE(loop->post(sbs::SystemEvent::User));
+    TEST_ASSERT_FALSE(sbs::time::sleep(0));
+    {
+        const sbs::NodeScope scope{*nodes.front()};
+        TEST_ASSERT_TRUE(sbs::time::sleep(0));
+        TEST_ASSERT_EQUAL(1, sbs::events().dispatch());
+    }
+#endif
+}
@@ -8,6 +8,17 @@
 #include "../test_base.h"
 #include "string_utest.h"
 #include "print_utest.h"
+#include "logsink_utest.h"
+#include "binarylog_utest.h"
+#include "loglevel_utest.h"
+#include "logline_utest.h"
+#include "format_utest.h"
+#include "logstamp_utest.h"
+#include "flashlog_utest.h"
+#include "coroutine_utest.h"
+#include "eventloop_utest.h"
+#include "node_utest.h"
+#include "executor_utest.h"
 
 int runtest(){
     UNITY_BEGIN();
@@ -15,5 +26,28 @@ int runtest(){
     RUN_TEST(logger_test);
     RUN_TEST(other_test);
     RUN_TEST(float_test);
+    RUN_TEST(logsink_buffered_test);
+    RUN_TEST(logsink_drop_test);
+    RUN_TEST(logsink_direct_test);
+    RUN_TEST(logsink_routing_test);
+    RUN_TEST(binarylog_text_test);
+    RUN_TEST(binarylog_record_test);
+    RUN_TEST(loglevel_test);
+    RUN_TEST(logline_test);
+    RUN_TEST(format_test);
+    RUN_TEST(format_legacy_test);
+#ifdef SBS_BENCHMARK
+    RUN_TEST(format_benchmark);
+#endif
+    RUN_TEST(logstamp_test);
+    RUN_TEST(loglimiter_test);
+    RUN_TEST(flashlog_test);
+    RUN_TEST(flashlog_rotation_test);
+    RUN_TEST(coroutine_test);
+    RUN_TEST(eventloop_test);
+    RUN_TEST(eventloop_network_test);
+    RUN_TEST(eventqueue_thread_test);
+    RUN_TEST(node_test);
+    RUN_TEST(executor_test);
     return UNITY_END();
 }
@@ -0,0 +1,54 @@
+/**
+ * @file fusion_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <data/Fusion.h>
+
+void fusion_base() {
+    sbs::data::SensorFusion fusion;
+    TEST_ASSERT_FALSE(fusion.ready());
+    uint8_t first  = fusion.addSource(1.0);
+    uint8_t second = fusion.addSource(1.0);
+    TEST_ASSERT_EQUAL(0, first);
+    TEST_ASSERT_EQUAL(1, second);
+    TEST_ASSERT_EQUAL(2, fusion.size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, fusion.update(5, 12.0, 0));// unknown source
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 20.0, fusion.update(first, 20.0, 0));
+    TEST_ASSERT_TRUE(fusion.ready());
+    // same variance, same date: plain average
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 21.0, fusion.update(second, 22.0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.5, fusion.variance());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 21.0, fusion.value());
+    fusion.addSource(1.0);
+    fusion.addSource(1.0);
+    TEST_ASSERT_EQUAL(sbs::data::SensorFusion::invalidSource, fusion.addSource(1.0));
+    fusion.reset();
+    TEST_ASSERT_FALSE(fusion.ready());
+}
+
+void fusion_bias() {
+    sbs::data::SensorFusion fusion(0.0, 0.1);
+    uint8_t biased    = fusion.addSource(1.0);
+    uint8_t reference = fusion.addSource(0.1, true);
+    // biased source reads 2 units too high
+    for (uint32_t i = 0; i < 200; ++i) {
+        fusion.update(reference, 10.0, i * 100);
+        fusion.update(biased, 12.0, i * 100 + 50);
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 2.0, fusion.getBias(biased));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, fusion.getBias(reference));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 10.0, fusion.value());
+    fusion.setBias(reference, 5.0);// ignored
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, fusion.getBias(reference));
+    fusion.setBias(biased, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, fusion.getBias(biased));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, fusion.getBias(7));
+    fusion.resetBiases();
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, fusion.getBias(biased));
+    TEST_ASSERT_FALSE(fusion.ready());
+}
@@ -0,0 +1,20 @@
+/**
+ * @file test_data.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../test_base.h"
+#include "fusion_utest.h"
+#include "timeseries_utest.h"
+
+int runtest(){
+    UNITY_BEGIN();
+    RUN_TEST(timeseries_float);
+    RUN_TEST(timeseries_fixed);
+    RUN_TEST(timeseries_window);
+    RUN_TEST(fusion_base);
+    RUN_TEST(fusion_bias);
+    return UNITY_END();
+}
@@ -0,0 +1,77 @@
+/**
+ * @file timeseries_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <data/TimeSeries.h>
+
+void timeseries_float() {
+    sbs::data::TimeSeries<float, 3, 4> series;
+    TEST_ASSERT_TRUE(series.empty());
+    TEST_ASSERT_EQUAL(4, series.capacity());
+    TEST_ASSERT_EQUAL(3, series.channels());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, series.all(0).mean());
+    series.append(10, 20.5, 45.0, 1013.25);
+    series.append(20, 21.5, 46.0, 1013.75);
+    TEST_ASSERT_EQUAL(2, series.size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 21.0, series.all(0).mean());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2027.0, series.all(2).sum());
+    TEST_ASSERT_EQUAL(20, series.timestamp(1));
+    // overwrite the oldest
+    series.append(30, 22.5, 47.0, 1014.0);
+    series.append(40, 23.5, 48.0, 1015.0);
+    series.append(50, 24.5, 49.0, 1016.0);
+    TEST_ASSERT_EQUAL(4, series.size());
+    TEST_ASSERT_EQUAL(20, series.timestamp(0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 21.5, series.value(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 24.5, series.value(0, 3));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 23.0, series.all(0).mean());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 46.0, series.all(1).min());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 49.0, series.all(1).max());
+    series.clear();
+    TEST_ASSERT_EQUAL(0, series.size());
+}
+
+void timeseries_fixed() {
+    sbs::data::TimeSeries<int16_t, 2, 8> series;
+    series.setChannelFormat(0, 1000.0F, 0.01F);
+    series.setChannelFormat(1, 0.0F, 0.0F);// ignored: null resolution
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, series.getChannelFormat(1).resolution);
+    series.append(0, 1013.25, 12.0);
+    series.append(1, 986.09, -3.4);
+    series.append(2, 2000.0, 40000.0);// saturated
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 1013.25, series.value(0, 0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 986.09, series.value(0, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 1327.67, series.value(0, 2));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -3.0, series.value(1, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 32767.0, series.value(1, 2));
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 999.67, series.window(0, 0, 2).mean());
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 1999.34, series.window(0, 0, 2).sum());
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 986.09, series.all(0).min());
+    TEST_ASSERT_DOUBLE_WITHIN(0.005, 1327.67, series.all(0).max());
+}
+
+void timeseries_window() {
+    sbs::data::TimeSeries<float, 1, 5> series;
+    for (uint32_t i = 0; i < 7; ++i)
+        series.append(i * 100, static_cast<float>(i));
+    // kept samples: 2 3 4 5 6
+    auto win = series.window(0, 1, 10);
+    TEST_ASSERT_EQUAL(4, win.size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 3.0, win[0]);
+    TEST_ASSERT_EQUAL(300, win.timestamp(0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 4.5, win.mean());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 5.5, series.last(0, 2).mean());
+    TEST_ASSERT_EQUAL(5, series.last(0, 20).size());
+    TEST_ASSERT_TRUE(series.window(0, 9, 1).empty());
+    auto recent = series.since(0, 350);
+    TEST_ASSERT_EQUAL(3, recent.size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 5.0, recent.mean());
+    TEST_ASSERT_EQUAL(0, series.since(0, 1000).size());
+    TEST_ASSERT_EQUAL(5, series.since(0, 0).size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, series.since(0, 1000).min());
+}
@@ -0,0 +1,13 @@
+/**
+ * @file timeseries_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void timeseries_float();
+void timeseries_fixed();
+void timeseries_window();
@@ -11,31 +11,38 @@
 #include <unity.h>
 
 #ifdef NATIVE
-#include <iostream>
-#include <sstream>
+#include <core/LogSink.h>
+#include <string>
 
 namespace testHelper {
-[[maybe_unused]] static std::streambuf* old = nullptr;
-[[maybe_unused]] static std::stringstream buffer;
+/// Sink capturing the log output in place of the serial sink
+[[maybe_unused]] static sbs::io::CaptureSink capture;
+/**
+ * @brief Access to the captured output (after flushing the log)
+ * @return The output
+ */
+[[maybe_unused]] static const std::string& output() {
+    sbs::io::flushLog();
+    return capture.str();
+}
 }// namespace testHelper
 
-#define SBS_START_REDIRECT_OUT                                     \
-    if (testHelper::old != nullptr) {                              \
-        std::cout.rdbuf(testHelper::old);                          \
-        testHelper::buffer.str("");                                \
-        testHelper::old = nullptr;                                 \
-    }                                                              \
-    testHelper::old = std::cout.rdbuf(testHelper::buffer.rdbuf()); \
-    testHelper::buffer.str("");
+#define SBS_START_REDIRECT_OUT                  \
+    sbs::io::flushLog();                        \
+    sbs::io::removeSink(sbs::io::serialSink()); \
+    sbs::io::addSink(testHelper::capture);      \
+    testHelper::capture.clear();
 
-#define SBS_END_REDIRECT_OUT              \
-    if (testHelper::old != nullptr) {     \
-        std::cout.rdbuf(testHelper::old); \
-        testHelper::buffer.str("");       \
-        testHelper::old = nullptr;        \
-    }
-#define SBS_RESET_OUT testHelper::buffer.str("");
-#define SBS_TEST_OUT(X) TEST_ASSERT_EQUAL_STRING(X, testHelper::buffer.str().c_str())
+#define SBS_END_REDIRECT_OUT                  \
+    sbs::io::flushLog();                      \
+    sbs::io::removeSink(testHelper::capture); \
+    sbs::io::addSink(sbs::io::serialSink());  \
+    testHelper::capture.clear();
+#define SBS_RESET_OUT    \
+    sbs::io::flushLog(); \
+    testHelper::capture.clear();
+#define SBS_TEST_OUT(X) \
+    TEST_ASSERT_EQUAL_STRING(X, testHelper::output().c_str())
 #else
 #define SBS_START_REDIRECT_OUT
 #define SBS_END_REDIRECT_OUT
@@ -0,0 +1,140 @@
+/**
+ * @file statistics_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <math/filters.h>
+#include <math/statistics.h>
+
+void statistics_test() {
+    sbs::math::RunningStats<double> stats;
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, stats.variance());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.0, stats.populationVariance());
+    const double samples[] = {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0};
+    for (double val : samples)
+        stats.push(val);
+    TEST_ASSERT_EQUAL(8, stats.size());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 5.0, stats.mean());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 4.0, stats.populationVariance());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 32.0 / 7.0, stats.variance());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.1380899, stats.stddev());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.0, stats.min());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 9.0, stats.max());
+    stats.reset();
+    TEST_ASSERT_EQUAL(0, stats.size());
+    stats.push(-3.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -3.0, stats.min());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -3.0, stats.max());
+
+    sbs::math::MinMax<int16_t> extremes;
+    extremes.push(5);
+    extremes.push(-12);
+    extremes.push(42);
+    TEST_ASSERT_EQUAL(3, extremes.size());
+    TEST_ASSERT_EQUAL(-12, extremes.min());
+    TEST_ASSERT_EQUAL(42, extremes.max());
+}
+
+void filters_test() {
+    sbs::math::Ema<double> ema(0.5);
+    TEST_ASSERT_FALSE(ema.ready());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 10.0, ema.push(10.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 15.0, ema.push(20.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 17.5, ema.push(20.0));
+    TEST_ASSERT_TRUE(ema.ready());
+    ema.setAlpha(1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, ema.getAlpha());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 3.0, ema.push(3.0));
+    ema.reset();
+    TEST_ASSERT_FALSE(ema.ready());
+
+    sbs::math::MedianFilter<int32_t, 3> median;
+    TEST_ASSERT_EQUAL(5, median.push(5));
+    TEST_ASSERT_EQUAL(1, median.push(1));// lower median of {1,5}
+    TEST_ASSERT_EQUAL(5, median.push(100));
+    TEST_ASSERT_EQUAL(6, median.push(6));// window {1,100,6}
+    TEST_ASSERT_EQUAL(7, median.push(7));// window {100,6,7}
+    TEST_ASSERT_EQUAL(7, median.push(7));// window {6,7,7}
+    TEST_ASSERT_EQUAL(3, median.size());
+    median.reset();
+    TEST_ASSERT_EQUAL(0, median.size());
+    // a NaN sample leaves the window like the others
+    sbs::math::MedianFilter<double, 3> noisy;
+    noisy.push(1.0);
+    noisy.push(2.0);
+    noisy.push(__builtin_nan(""));
+    noisy.push(3.0);
+    noisy.push(5.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 5.0, noisy.push(6.0));// window {3,5,6}
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 6.0, noisy.push(7.0));// window {5,6,7}
+}
+
+void decimators_test() {
+    sbs::math::BoxcarDecimator<float, 4, double> boxcar;
+    TEST_ASSERT_FALSE(boxcar.push(1.0F));
+    TEST_ASSERT_FALSE(boxcar.push(2.0F));
+    TEST_ASSERT_FALSE(boxcar.push(3.0F));
+    TEST_ASSERT_TRUE(boxcar.push(4.0F));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.5, boxcar.value());
+    boxcar.push(8.0F);
+    boxcar.reset();
+    for (int i = 0; i < 3; ++i) boxcar.push(1.0F);
+    TEST_ASSERT_TRUE(boxcar.push(1.0F));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, boxcar.value());
+
+    sbs::math::CicDecimator<2, 4> cic;
+    TEST_ASSERT_EQUAL(16, cic.gain());
+    int outputs = 0;
+    for (int i = 0; i < 40; ++i) {
+        if (cic.push(1000)) ++outputs;
+    }
+    TEST_ASSERT_EQUAL(10, outputs);
+    // steady state on a constant input is the input itself
+    TEST_ASSERT_EQUAL(1000, cic.value());
+    cic.reset();
+    TEST_ASSERT_EQUAL(0, cic.value());
+    // the integrators wrap many times, the output stays exact
+    for (int i = 0; i < 1000; ++i) cic.push(-100000);
+    TEST_ASSERT_EQUAL_INT32(-100000, cic.value());
+}
+
+void batch_filters_test() {
+    // a long series handled by parts gives the same output as one filter
+    constexpr size_t count = 3 * SBS_BATCH_GRAIN + 17;
+    static int32_t samples[count];
+    static int32_t filtered[count];
+    for (size_t i = 0; i < count; ++i)
+        samples[i] = static_cast<int32_t>((i * 7919U) % 1000U);
+    sbs::math::medianFilter<int32_t, 5>(samples, filtered, count);
+    sbs::math::MedianFilter<int32_t, 5> median;
+    bool same = true;
+    for (size_t i = 0; i < count; ++i)
+        same = same && filtered[i] == median.push(samples[i]);
+    TEST_ASSERT_TRUE(same);
+
+    TEST_ASSERT_EQUAL(count / 4, (sbs::math::boxcarDecimate<int32_t, 4, int64_t>(samples, filtered, count)));
+    sbs::math::BoxcarDecimator<int32_t, 4, int64_t> boxcar;
+    same = true;
+    for (size_t i = 0; i < count / 4 * 4; ++i) {
+        if (boxcar.push(samples[i])) same = same && filtered[i / 4] == boxcar.value();
+    }
+    TEST_ASSERT_TRUE(same);
+
+    // independent channels, in place
+    constexpr size_t channels = 6;
+    constexpr size_t length   = 100;
+    static double series[channels * length];
+    for (size_t i = 0; i < channels * length; ++i)
+        series[i] = static_cast<double>(i / length);
+    sbs::math::Ema<double> emas[channels] = {sbs::math::Ema<double>(0.5), sbs::math::Ema<double>(0.5), sbs::math::Ema<double>(0.5),
+                                             sbs::math::Ema<double>(0.5), sbs::math::Ema<double>(0.5), sbs::math::Ema<double>(0.5)};
+    sbs::math::filterChannels(emas, series, series, channels, length);
+    for (size_t channel = 0; channel < channels; ++channel) {
+        TEST_ASSERT_DOUBLE_WITHIN(0.00001, static_cast<double>(channel), emas[channel].value());
+        TEST_ASSERT_DOUBLE_WITHIN(0.00001, static_cast<double>(channel), series[channel * length + length - 1]);
+    }
+}
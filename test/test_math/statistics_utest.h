@@ -0,0 +1,14 @@
+/**
+ * @file statistics_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void statistics_test();
+void filters_test();
+void decimators_test();
+void batch_filters_test();
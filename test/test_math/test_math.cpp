@@ -7,9 +7,14 @@
  */
 #include "../test_base.h"
 #include "base_utest.h"
+#include "statistics_utest.h"
 
 int runtest(){
     UNITY_BEGIN();
     RUN_TEST(basic_test);
+    RUN_TEST(statistics_test);
+    RUN_TEST(filters_test);
+    RUN_TEST(decimators_test);
+    RUN_TEST(batch_filters_test);
     return UNITY_END();
 }
@@ -25,3 +25,31 @@ void basicphysic_test(){
     TEST_ASSERT_DOUBLE_WITHIN(0.1,10.5385861,sbs::physic::computeDewPoint(30,30));
     TEST_ASSERT_DOUBLE_WITHIN(0.1,-24.328009,sbs::physic::computeDewPoint(-10,30));
 }
+
+void batchphysic_test(){
+    constexpr size_t count = 10000;
+    static double temperatures[count];
+    static double values[count];
+    static double output[count];
+    for (size_t i = 0; i < count; ++i) {
+        temperatures[i] = -20.0 + static_cast<double>(i % 60);
+        values[i]       = 950.0 + static_cast<double>(i % 100);
+    }
+    bool same = true;
+    sbs::physic::getAltitude(1020, values, temperatures, output, count);
+    for (size_t i = 0; i < count; ++i)
+        same = same && output[i] == sbs::physic::getAltitude(1020, values[i], temperatures[i]);
+    sbs::physic::computeQnh(300, values, temperatures, output, count);
+    for (size_t i = 0; i < count; ++i)
+        same = same && output[i] == sbs::physic::computeQnh(300, values[i], temperatures[i]);
+    for (size_t i = 0; i < count; ++i)
+        values[i] = 10.0 + static_cast<double>(i % 90);
+    sbs::physic::computeDewPoint(temperatures, values, output, count);
+    for (size_t i = 0; i < count; ++i)
+        same = same && output[i] == sbs::physic::computeDewPoint(temperatures[i], values[i]);
+    TEST_ASSERT_TRUE(same);
+    // in place
+    sbs::physic::celsiusToKelvin(temperatures, temperatures, count);
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 253.15, temperatures[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 292.15, temperatures[count - 1]);
+}
@@ -10,3 +10,4 @@
 
 void basicphysic_test();
 void constant_test();
+void batchphysic_test();
@@ -12,5 +12,6 @@ int runtest(){
     UNITY_BEGIN();
     RUN_TEST(basicphysic_test);
     RUN_TEST(constant_test);
+    RUN_TEST(batchphysic_test);
     return UNITY_END();
 }
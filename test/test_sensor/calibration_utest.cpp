@@ -0,0 +1,106 @@
+/**
+ * @file calibration_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include "io/CalibrationCache.h"
+#include "io/i2c/utils.h"
+#include "sensor/Hts221.h"
+#ifdef NATIVE
+#include <cstdio>
+#endif
+
+void calibration_cache() {
+    namespace cal = sbs::io::calibration;
+    cal::clear();
+    uint8_t blob[4] = {1, 2, 3, 4};
+    uint8_t out[4]  = {0, 0, 0, 0};
+    TEST_ASSERT_FALSE(cal::load(0x10, 0x20, 4, out));
+    cal::store(0x10, 0x20, 4, blob);
+    TEST_ASSERT_FALSE(cal::load(0x10, 0x20, 3, out));// wrong size
+    TEST_ASSERT_FALSE(cal::load(0x11, 0x20, 4, out));// wrong address
+    TEST_ASSERT_TRUE(cal::load(0x10, 0x20, 4, out));
+    TEST_ASSERT_EQUAL(3, out[2]);
+    blob[2] = 42;
+    cal::store(0x10, 0x20, 4, blob);// replace
+    TEST_ASSERT_TRUE(cal::load(0x10, 0x20, 4, out));
+    TEST_ASSERT_EQUAL(42, out[2]);
+    cal::store(0x10, 0x21, 0, blob);// ignored
+    TEST_ASSERT_FALSE(cal::load(0x10, 0x21, 0, out));
+    // fill the cache: oldest entries get replaced
+    for (uint8_t i = 0; i < SBS_CALIBRATION_SLOTS + 1; ++i)
+        cal::store(0x40 + i, 0x20, 4, blob);
+    TEST_ASSERT_TRUE(cal::load(0x40 + SBS_CALIBRATION_SLOTS, 0x20, 4, out));
+    cal::invalidate(0x40 + SBS_CALIBRATION_SLOTS, 0x20);
+    TEST_ASSERT_FALSE(cal::load(0x40 + SBS_CALIBRATION_SLOTS, 0x20, 4, out));
+    cal::clear();
+    TEST_ASSERT_FALSE(cal::load(0x41, 0x20, 4, out));
+}
+
+void calibration_persistence() {
+#ifdef NATIVE
+    namespace cal = sbs::io::calibration;
+    std::remove(SBS_CALIBRATION_FILE);
+    TEST_ASSERT_FALSE(cal::restore());
+    uint8_t blob[3] = {7, 8, 9};
+    uint8_t out[3]  = {0, 0, 0};
+    cal::setAutoSave(true);
+    cal::store(0x33, 0x44, 3, blob);
+    cal::setAutoSave(false);
+    cal::clear();
+    TEST_ASSERT_FALSE(cal::load(0x33, 0x44, 3, out));
+    TEST_ASSERT_TRUE(cal::restore());
+    TEST_ASSERT_TRUE(cal::load(0x33, 0x44, 3, out));
+    TEST_ASSERT_EQUAL(9, out[2]);
+    // corrupted image is refused
+    FILE* file = fopen(SBS_CALIBRATION_FILE, "wb");
+    fputs("garbage", file);
+    fclose(file);
+    TEST_ASSERT_FALSE(cal::restore());
+    std::remove(SBS_CALIBRATION_FILE);
+    cal::clear();
+#endif
+}
+
+void calibration_warm_start() {
+    sbs::io::calibration::clear();
+    sbs::io::i2c::setEmulatedMode(true);
+    uint8_t buffer[] = {0xBC, 0xBC,
+                        0x3A, 0x85, 0xA6, 0x16,
+                        0x00, 0xC4, 0xF3, 0xFF,
+                        0x00, 0x00, 0x88, 0xCF,
+                        0xFD, 0xFF, 0xFB, 0x02};
+    {
+        sbs::sensor::Hts221 device;
+        sbs::io::i2c::setEmulatedBuffer(18, buffer);
+        device.selfCheck();
+        TEST_ASSERT_TRUE(device.presence());
+    }
+    // a new connection of the same chip does not read the calibration again
+    sbs::sensor::Hts221 device;
+    // only the first bytes of the calibration are read, to check the unit
+    uint8_t buffer2[] = {0xBC, 0xBC, 0x3A, 0x85, 0x01, 0x00, 0x01, 0x00, 0x58, 0x02, 0x1E, 0xE8};
+    sbs::io::i2c::setEmulatedBuffer(12, buffer2);
+    device.selfCheck();
+    TEST_ASSERT_TRUE(device.presence());
+    auto data = device.getValue();
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 31.7708877, data.temperature);
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 47.4580476, data.humidity);
+    // another unit of the same model: the calibration is read again
+    sbs::sensor::Hts221 other;
+    buffer[3] = 0x86;
+    uint8_t buffer3[20] = {0xBC, 0xBC, 0x3A, 0x86};
+    memcpy(buffer3 + 4, buffer + 2, 16);
+    sbs::io::i2c::setEmulatedBuffer(20, buffer3);
+    other.selfCheck();
+    TEST_ASSERT_TRUE(other.presence());
+    uint8_t blob[16] = {};
+    TEST_ASSERT_TRUE(sbs::io::calibration::load(other.getAddress(), 0xBC, 16, blob));
+    TEST_ASSERT_EQUAL_UINT8(0x86, blob[1]);
+    sbs::io::i2c::setEmulatedMode(false);
+    sbs::io::calibration::clear();
+}
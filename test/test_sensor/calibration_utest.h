@@ -0,0 +1,19 @@
+/**
+ * @file calibration_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void calibration_cache();
+void calibration_persistence();
+void calibration_warm_start();
+
+void run_calibration(){
+    RUN_TEST(calibration_cache);
+    RUN_TEST(calibration_persistence);
+    RUN_TEST(calibration_warm_start);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file correction_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include "io/i2c/utils.h"
+#include "sensor/Bme280.h"
+#include "sensor/Correction.h"
+#include "sensor/Hts221.h"
+#include "sensor/Lps22hb.h"
+
+using sbs::sensor::ChannelCorrection;
+
+void correction_linear() {
+    ChannelCorrection correction;
+    TEST_ASSERT_TRUE(correction.isIdentity());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 12.5, correction.apply(12.5));
+    correction.setLinear(2.0, -3.0);
+    TEST_ASSERT_FALSE(correction.isIdentity());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 22.0, correction.apply(12.5));
+    ChannelCorrection negative{-0.5, -1.4};
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -101.4, negative.apply(200.0));
+    auto folded = correction.fold(0.01, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.02, folded.scale);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -1.0, folded.bias);
+    sbs::sensor::CorrectedChannel channel{0.01, 1.0};
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.0, channel.convert(100));
+    channel.setCorrection(correction);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, channel.convert(100));
+    channel.setConversion(0.1, 0.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 17.0, channel.convert(100));
+    correction.reset();
+    TEST_ASSERT_TRUE(correction.isIdentity());
+}
+
+void correction_table() {
+    ChannelCorrection correction;
+    const ChannelCorrection::Point bad[] = {{0.0, 0.0}, {0.0, 1.0}};
+    TEST_ASSERT_FALSE(correction.setTable(bad, 2));
+    TEST_ASSERT_FALSE(correction.setTable(bad, 1));
+    TEST_ASSERT_FALSE(correction.setTable(nullptr, 2));
+    const ChannelCorrection::Point points[] = {{0.0, 0.0}, {10.0, 20.0}, {20.0, 25.0}};
+    TEST_ASSERT_TRUE(correction.setTable(points, 3));
+    TEST_ASSERT_TRUE(correction.isTable());
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -2.0, correction.apply(-1.0));// extended first segment
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 10.0, correction.apply(5.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 20.0, correction.apply(10.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 22.5, correction.apply(15.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 30.0, correction.apply(30.0));// extended last segment
+    sbs::sensor::CorrectedChannel channel{0.1, 0.0};
+    channel.setCorrection(correction);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 22.5, channel.convert(150));
+    TEST_ASSERT_FALSE(correction.calibrate(1.0, 2.0));
+    TEST_ASSERT_FALSE(correction.calibrate(1.0, 2.0, 3.0, 4.0));
+}
+
+void correction_calibrate() {
+    ChannelCorrection correction{1.0, 1.0};
+    // sensor reads 11 for 10 and 31 for 25 with the current correction
+    TEST_ASSERT_FALSE(correction.calibrate(11.0, 10.0, 11.0, 25.0));
+    TEST_ASSERT_TRUE(correction.calibrate(11.0, 10.0, 31.0, 25.0));
+    // uncorrected readings were 10 and 30
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 10.0, correction.apply(10.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 25.0, correction.apply(30.0));
+    TEST_ASSERT_TRUE(correction.calibrate(10.0, 12.0));
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 12.0, correction.apply(10.0));
+}
+
+void correction_drivers() {
+    sbs::sensor::Lps22hb lps;
+    lps.setPressureOffset(2.5);
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.5, lps.getPressureOffset());
+    lps.setCorrection(sbs::sensor::Lps22hb::Channel::Temperature, ChannelCorrection{1.0, 1.0});
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 1.0, lps.getCorrection(sbs::sensor::Lps22hb::Channel::Temperature).getOffset());
+    sbs::io::i2c::setEmulatedMode(true);
+    uint8_t buffer[] = {0xb1, 0xb1};
+    sbs::io::i2c::setEmulatedBuffer(2, buffer);
+    lps.selfCheck();
+    uint8_t buffer2[] = {0x01, 0x00, 0xE2, 0xF8, 0x3D, 0xD9, 0x0A};
+    sbs::io::i2c::setEmulatedBuffer(7, buffer2);
+    auto data = lps.getValue();
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 28.77, data.temperature);
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 989.055176, data.pressure);
+    sbs::io::i2c::setEmulatedMode(false);
+
+    sbs::sensor::Hts221 hts;
+    hts.setCorrection(sbs::sensor::Hts221::Channel::Humidity, ChannelCorrection{1.0, -2.0});
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, -2.0, hts.getCorrection(sbs::sensor::Hts221::Channel::Humidity).getOffset());
+    TEST_ASSERT_TRUE(hts.getCorrection(sbs::sensor::Hts221::Channel::Temperature).isIdentity());
+    hts.setCorrection(sbs::sensor::Hts221::Channel::Temperature, ChannelCorrection{2.0, 0.0});
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 2.0, hts.getCorrection(sbs::sensor::Hts221::Channel::Temperature).getGain());
+
+    sbs::sensor::BME280 bme;
+    bme.setCorrection(sbs::sensor::BME280::Channel::Pressure, ChannelCorrection{1.0, 0.5});
+    TEST_ASSERT_DOUBLE_WITHIN(0.00001, 0.5, bme.getCorrection(sbs::sensor::BME280::Channel::Pressure).getOffset());
+    TEST_ASSERT_TRUE(bme.getCorrection(sbs::sensor::BME280::Channel::Humidity).isIdentity());
+}
@@ -0,0 +1,21 @@
+/**
+ * @file correction_utest.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+void correction_linear();
+void correction_table();
+void correction_calibrate();
+void correction_drivers();
+
+void run_correction(){
+    RUN_TEST(correction_linear);
+    RUN_TEST(correction_table);
+    RUN_TEST(correction_calibrate);
+    RUN_TEST(correction_drivers);
+}
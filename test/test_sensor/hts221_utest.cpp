@@ -20,11 +20,11 @@ void hts221_emulated() {
     sbs::sensor::Hts221 device;
     sbs::io::i2c::setEmulatedMode(true);
     uint8_t buffer[] = {0xBC, 0xBC,
-                        0x3A, 0x85,
-                        0xA6, 0xC4, 0x16, 0xC4,
-                        0xF3, 0xFF, 0x88, 0xCF,
+                        0x3A, 0x85, 0xA6, 0x16,
+                        0x00, 0xC4, 0xF3, 0xFF,
+                        0x00, 0x00, 0x88, 0xCF,
                         0xFD, 0xFF, 0xFB, 0x02};
-    sbs::io::i2c::setEmulatedBuffer(16, buffer);
+    sbs::io::i2c::setEmulatedBuffer(18, buffer);
     device.selfCheck();
     TEST_ASSERT_TRUE(device.presence());
     uint8_t buffer2[] = {0x01, 0x00, 0x01, 0x00, 0x58, 0x02, 0x1E, 0xE8};
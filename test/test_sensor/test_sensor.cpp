@@ -12,6 +12,8 @@
 #include "hts221_utest.h"
 #include "veml6075_utest.h"
 #include "bq24195l_utest.h"
+#include "calibration_utest.h"
+#include "correction_utest.h"
 
 int runtest(){
     UNITY_BEGIN();
@@ -21,5 +23,7 @@ int runtest(){
     run_hts221();
     run_veml6075();
     run_bq24195l();
+    run_calibration();
+    run_correction();
     return UNITY_END();
 }
@@ -21,12 +21,12 @@ void mkrenv_base() {
 void mkrenv_emulated() {
     sbs::shield::MKREnv device;
     sbs::io::i2c::setEmulatedMode(true);
-    uint8_t buffer[] = {0xBC, 0xBC, 0x3A, 0x85, 0xA6, 0xC4, 0x16, 0xC4,
-                        0xF3, 0xFF, 0x88, 0xCF, 0xFD, 0xFF, 0xFB, 0x02,
-                        0x3A, 0x85, 0xA6, 0xC4, 0x16, 0xC4,
-                        0xF3, 0xFF, 0x88, 0xCF, 0xFD, 0xFF, 0xFB, 0x02,
-                        0xB1, 0xB1, 0x26, 0x00, 0x26, 0x00};
-    sbs::io::i2c::setEmulatedBuffer(36, buffer);
+    // the HTS221 init runs twice: the second one only checks the cached calibration
+    uint8_t buffer[] = {0xBC, 0xBC, 0x3A, 0x85, 0xA6, 0x16, 0x00, 0xC4,
+                        0xF3, 0xFF, 0x00, 0x00, 0x88, 0xCF, 0xFD, 0xFF,
+                        0xFB, 0x02, 0x3A, 0x85, 0xB1, 0xB1, 0x26, 0x00,
+                        0x26, 0x00};
+    sbs::io::i2c::setEmulatedBuffer(26, buffer);
     device.init();
     uint8_t buffer2[] = {
             0x01,
@@ -55,7 +55,7 @@ void mkrenv_emulated() {
     };
     sbs::io::i2c::setEmulatedBuffer(23, buffer2);
     auto data = device.getValue();
-    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 29.7704439, data.temperature);
+    TEST_ASSERT_DOUBLE_WITHIN(0.0001, 31.3707989, data.temperature);
     TEST_ASSERT_DOUBLE_WITHIN(0.0001, 991.555176, data.pressure);
     TEST_ASSERT_DOUBLE_WITHIN(0.0001, 47.4580476, data.humidity);
     TEST_ASSERT_DOUBLE_WITHIN(0.0001, 247.15, data.UVa);
@@ -0,0 +1,58 @@
+/**
+ * @file duration_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/Duration.h>
+
+void duration_test() {
+    using sbs::time::Duration;
+    using sbs::time::Instant;
+    constexpr Duration second = Duration::seconds(1);
+    TEST_ASSERT_TRUE(second == Duration::milliseconds(1000));
+    TEST_ASSERT_TRUE(second == Duration::microseconds(1000000));
+    TEST_ASSERT_TRUE((second * 3 - Duration::milliseconds(500)).toMilliseconds() == 2500);
+    TEST_ASSERT_TRUE((second / 4).toMicroseconds() == 250000);
+    TEST_ASSERT_TRUE(-second < Duration{});
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1.5, (second + second / 2).toSeconds());
+    // instants beyond the 32-bit microsecond range stay ordered
+    const Instant early = Instant::fromMicroseconds(0xFFFFFF00U);
+    const Instant late  = early + Duration::microseconds(0x200);
+    TEST_ASSERT_TRUE(early < late);
+    TEST_ASSERT_TRUE(late.toMicroseconds() == 0x100000100U);
+    TEST_ASSERT_TRUE(late - early == Duration::microseconds(0x200));
+    TEST_ASSERT_TRUE(early - late == Duration::microseconds(-0x200));
+    TEST_ASSERT_TRUE(late - Duration::microseconds(0x200) == early);
+    // wrap-safe comparison of 32-bit times
+    TEST_ASSERT_TRUE(sbs::time::isBefore(0xFFFFFFF0U, 0x10U));
+    TEST_ASSERT_FALSE(sbs::time::isBefore(0x10U, 0xFFFFFFF0U));
+    TEST_ASSERT_FALSE(sbs::time::isBefore(5, 5));
+}
+
+void monotonic_test() {
+    const uint64_t start  = sbs::time::micros64();
+    const auto instant    = sbs::time::Instant::now();
+    const uint32_t milli  = sbs::time::millis();
+    sbs::time::delay(2);
+    TEST_ASSERT_TRUE(sbs::time::micros64() >= start + 2000U);
+    TEST_ASSERT_TRUE(instant.elapsed() >= sbs::time::Duration::milliseconds(2));
+    TEST_ASSERT_TRUE(sbs::time::elapsedMillis(milli) >= 2);
+    TEST_ASSERT_TRUE(sbs::time::millis64() >= start / 1000U + 2U);
+#ifdef NATIVE
+    // past 71 minutes, the 32-bit counter wraps but not the 64-bit one
+    sbs::time::setVirtualTime(true);
+    sbs::time::setTime(0xFFFFFC18U);
+    const auto before = sbs::time::Instant::now();
+    sbs::time::delay(5);
+    const auto after = sbs::time::Instant::now();
+    TEST_ASSERT_TRUE(after > before);
+    TEST_ASSERT_TRUE(after - before == sbs::time::Duration::milliseconds(5));
+    TEST_ASSERT_TRUE(sbs::time::micros() < 0xFFFFFC18U);
+    TEST_ASSERT_TRUE(sbs::time::millis64() == (0xFFFFFC18ULL + 5000U) / 1000U);
+    sbs::time::setVirtualTime(false);
+#endif
+}
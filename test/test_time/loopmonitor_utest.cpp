@@ -0,0 +1,69 @@
+/**
+ * @file loopmonitor_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/LoopMonitor.h>
+
+/// Time of the fake clock
+static uint32_t loopNow = 0;
+
+/**
+ * @brief Fake clock of the test
+ * @return The fake time
+ */
+static uint32_t loopClock() {
+    return loopNow;
+}
+
+/**
+ * @brief Simulate an iteration of the loop
+ * @param monitor The monitor
+ * @param start Start of the iteration
+ * @param busy Busy time of the iteration
+ * @param idle Idle time of the iteration
+ */
+static void iteration(sbs::time::LoopMonitor& monitor, uint32_t start, uint32_t busy, uint32_t idle) {
+    loopNow = start;
+    monitor.begin();
+    monitor.addIdle(idle);
+    loopNow += busy + idle;
+    monitor.end();
+}
+
+void loopmonitor_test() {
+    static sbs::time::LoopMonitor monitor;
+    monitor.setClock(&loopClock);
+    monitor.setPeriod(1000);
+    const uint32_t base = 0xFFFFF000;// wraps during the test
+    iteration(monitor, base, 200, 800);
+    iteration(monitor, base + 1000, 300, 700);
+    iteration(monitor, base + 2010, 1500, 0);
+    iteration(monitor, base + 3600, 100, 300);
+    TEST_ASSERT_EQUAL_UINT32(4, monitor.getIterations());
+    TEST_ASSERT_EQUAL_UINT32(100, monitor.getMinDuration());
+    TEST_ASSERT_EQUAL_UINT32(1500, monitor.getMaxDuration());
+    TEST_ASSERT_EQUAL_UINT32(525, monitor.getMeanDuration());
+    TEST_ASSERT_EQUAL_UINT32(1, monitor.getMisses());
+    // jitters: 0, 10, 590
+    TEST_ASSERT_EQUAL_UINT32(590, monitor.getMaxJitter());
+    TEST_ASSERT_EQUAL_UINT16(2, monitor.getBucket(0));
+    TEST_ASSERT_EQUAL_UINT16(1, monitor.getBucket(3));
+    SBS_START_REDIRECT_OUT
+    monitor.report();
+    SBS_TEST_OUT("LOOP n=4 min=100 mean=525 max=1500 jitter=590 miss=1 hist=2/0/0/1/0/0/0/0\n");
+    // periodic report
+    SBS_RESET_OUT
+    monitor.reset();
+    monitor.setReportPeriod(10);
+    iteration(monitor, base + 5000, 100, 0);
+    SBS_TEST_OUT("");
+    iteration(monitor, base + 20000, 100, 0);
+    SBS_TEST_OUT("LOOP n=2 min=100 mean=100 max=100 jitter=14000 miss=0 hist=0/0/0/1/0/1/0/0\n");
+    TEST_ASSERT_EQUAL_UINT32(0, monitor.getIterations());
+    SBS_END_REDIRECT_OUT
+}
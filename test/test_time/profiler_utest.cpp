@@ -0,0 +1,70 @@
+/**
+ * @file profiler_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/Profiler.h>
+
+/// Time of the fake clock
+static uint32_t profileNow = 0;
+
+/**
+ * @brief Fake clock of the test
+ * @return The fake time
+ */
+static uint32_t profileClock() {
+    return profileNow;
+}
+
+void profiler_test() {
+    static sbs::time::Profiler profiler;
+    profileNow = 1000;
+    profiler.setClock(&profileClock);
+    const auto read   = profiler.addZone("read");
+    const auto unused = profiler.addZone("unused");
+    TEST_ASSERT_EQUAL(2, profiler.getZoneCount());
+    TEST_ASSERT_EQUAL_STRING("read", profiler.getName(read));
+    profiler.record(read, 10);
+    profiler.record(read, 100);
+    profiler.record(read, 5000);
+    profiler.record(read, 1000000);
+    TEST_ASSERT_EQUAL_UINT32(4, profiler.getCount(read));
+    TEST_ASSERT_EQUAL_UINT32(10, profiler.getMin(read));
+    TEST_ASSERT_EQUAL_UINT32(1000000, profiler.getMax(read));
+    TEST_ASSERT_EQUAL_UINT32(251277, profiler.getMean(read));
+    TEST_ASSERT_EQUAL_UINT32(0, profiler.getMean(unused));
+    TEST_ASSERT_EQUAL_UINT16(1, profiler.getBucket(read, 0));
+    TEST_ASSERT_EQUAL_UINT16(1, profiler.getBucket(read, 2));
+    TEST_ASSERT_EQUAL_UINT16(1, profiler.getBucket(read, 5));
+    TEST_ASSERT_EQUAL_UINT16(1, profiler.getBucket(read, 7));
+    // scope measure with the main profiler
+    sbs::time::profiler().setClock(&profileClock);
+    const auto scoped = sbs::time::profiler().addZone("scope");
+    {
+        sbs::time::ProfileScope scope{scoped};
+        profileNow += 40;
+    }
+    TEST_ASSERT_EQUAL_UINT32(40, sbs::time::profiler().getMax(scoped));
+    // half of the time in the zone
+    profileNow = 2011220;
+    TEST_ASSERT_DOUBLE_WITHIN(0.001, 50.0, profiler.getLoad(read));
+    SBS_START_REDIRECT_OUT
+    profiler.report();
+    SBS_TEST_OUT("PROF read n=4 min=10 mean=251277 max=1000000 load=50.00% hist=1/0/1/0/0/1/0/1\n");
+    // periodic report then reset
+    SBS_RESET_OUT
+    profiler.setReportPeriod(5000);
+    profiler.update();
+    TEST_ASSERT_EQUAL_UINT32(4, profiler.getCount(read));
+    profileNow = 5001000;
+    profiler.update();
+    TEST_ASSERT_TRUE(testHelper::output().length() > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, profiler.getCount(read));
+    TEST_ASSERT_EQUAL_STRING("read", profiler.getName(read));
+    SBS_END_REDIRECT_OUT
+    sbs::time::profiler().setClock(&sbs::time::micros);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file scheduler_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/Scheduler.h>
+
+/// Time of the fake clock
+static uint32_t fakeNow = 0;
+
+/**
+ * @brief Fake clock of the tests
+ * @return The fake time
+ */
+static uint32_t fakeClock() {
+    return fakeNow;
+}
+
+/// Trace of the task runs
+static char trace[32];
+/// Length of the trace
+static uint8_t traceLength = 0;
+
+/**
+ * @brief Task recording its run in the trace
+ * @param context Pointer to the character to record
+ */
+static void record(void* context) {
+    if (traceLength + 1 < static_cast<uint8_t>(sizeof(trace)))
+        trace[traceLength++] = *static_cast<const char*>(context);
+    trace[traceLength] = '\0';
+}
+
+/// Last idle time given to the idle hook
+static uint32_t lastIdle = 0;
+
+/**
+ * @brief Idle hook of the tests
+ * @param idle Time until the next task
+ */
+static void idleHook(uint32_t idle) {
+    lastIdle = idle;
+}
+
+/**
+ * @brief Reset the trace
+ */
+static void clearTrace() {
+    traceLength = 0;
+    trace[0]    = '\0';
+}
+
+void scheduler_periodic_test() {
+    static char a = 'a';
+    static char b = 'b';
+    static char o = 'o';
+    sbs::time::Scheduler scheduler;
+    fakeNow = 0xFFFFFF00;// wraps during the test
+    scheduler.setClock(&fakeClock);
+    scheduler.setIdleHook(&idleHook);
+    clearTrace();
+    auto fast = scheduler.addPeriodic("fast", 100, &record, &a);
+    auto slow = scheduler.addPeriodic("slow", 250, &record, &b);
+    auto once = scheduler.addOneShot("once", 150, &record, &o);
+    TEST_ASSERT_EQUAL(3, scheduler.getTaskCount());
+    TEST_ASSERT_EQUAL_STRING("slow", scheduler.getName(slow));
+    // nothing due: the idle hook gets the time until the first task
+    TEST_ASSERT_EQUAL_UINT32(100, scheduler.update());
+    TEST_ASSERT_EQUAL_UINT32(100, lastIdle);
+    for (uint16_t step = 0; step < 10; ++step) {
+        fakeNow += 50;
+        scheduler.update();
+    }
+    TEST_ASSERT_EQUAL_STRING("aoabaaab", trace);
+    // the one-shot task is gone
+    TEST_ASSERT_FALSE(scheduler.exists(once));
+    TEST_ASSERT_EQUAL(2, scheduler.getTaskCount());
+    // suspended task does not run, resumed task runs one period later
+    clearTrace();
+    scheduler.setEnabled(fast, false);
+    fakeNow += 250;
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("b", trace);
+    scheduler.setEnabled(fast, true);
+    fakeNow += 99;
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("b", trace);
+    fakeNow += 1;
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("ba", trace);
+    // a late task runs once and skips the lost runs
+    clearTrace();
+    scheduler.remove(slow);
+    fakeNow += 1000;
+    scheduler.update();
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+    TEST_ASSERT_EQUAL_UINT16(1, scheduler.getMissed(fast));
+    TEST_ASSERT_EQUAL_UINT32(100, scheduler.update());
+    scheduler.remove(fast);
+    TEST_ASSERT_EQUAL_UINT32(sbs::time::Scheduler::forever, scheduler.update());
+}
+
+void scheduler_priority_test() {
+    static char a = 'a';
+    static char b = 'b';
+    static char c = 'c';
+    sbs::time::Scheduler scheduler;
+    fakeNow = 1000;
+    scheduler.setClock(&fakeClock);
+    clearTrace();
+    // same priority: earliest deadline first
+    auto first  = scheduler.addOneShot("a", 10, &record, &a);
+    auto second = scheduler.addOneShot("b", 10, &record, &b);
+    scheduler.setDeadline(first, 50);
+    scheduler.setDeadline(second, 20);
+    // higher priority first
+    scheduler.addOneShot("c", 10, &record, &c, 2);
+    fakeNow += 10;
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("cba", trace);
+    // missed deadline is counted
+    clearTrace();
+    auto late = scheduler.addPeriodic("a", 10, &record, &a);
+    scheduler.setDeadline(late, 5);
+    fakeNow += 16;
+    scheduler.update();
+    TEST_ASSERT_EQUAL_UINT16(1, scheduler.getMissed(late));
+    scheduler.setPriority(late, 3);
+    scheduler.reschedule(late, 0);
+    scheduler.addOneShot("b", 0, &record, &b, 1);
+    scheduler.update();
+    TEST_ASSERT_EQUAL_STRING("aab", trace);
+    TEST_ASSERT_EQUAL_UINT16(1, scheduler.getMissed(late));
+    // full table
+    for (uint8_t i = scheduler.getTaskCount(); i < sbs::time::Scheduler::maxTasks; ++i)
+        TEST_ASSERT_NOT_EQUAL(sbs::time::Scheduler::invalidTask, scheduler.addOneShot("x", 100, &record, &c));
+    TEST_ASSERT_EQUAL(sbs::time::Scheduler::invalidTask, scheduler.addOneShot("x", 100, &record, &c));
+    scheduler.clear();
+    TEST_ASSERT_EQUAL(0, scheduler.getTaskCount());
+}
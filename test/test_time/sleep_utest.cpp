@@ -0,0 +1,38 @@
+/**
+ * @file sleep_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/Sleep.h>
+#include <time/timing.h>
+
+void sleep_test() {
+    uint32_t slept = sbs::time::getSleepTime();
+    // sleep until the deadline
+    uint32_t start = sbs::time::millis();
+    TEST_ASSERT_FALSE(sbs::time::sleep(20));
+    uint32_t elapsed = sbs::time::millis() - start;
+    TEST_ASSERT_TRUE(elapsed >= 20);
+    TEST_ASSERT_TRUE(elapsed < 40);
+    TEST_ASSERT_TRUE(sbs::time::getSleepTime() - slept >= 20);
+    // a wake up request ends the sleep at once
+    sbs::time::wakeUp();
+    start = sbs::time::millis();
+    TEST_ASSERT_TRUE(sbs::time::sleep(1000));
+    TEST_ASSERT_TRUE(sbs::time::millis() - start < 20);
+    // the request is consumed
+    TEST_ASSERT_FALSE(sbs::time::sleep(1));
+    // the idle hook pushes the log out before sleeping
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    SBS_START_REDIRECT_OUT
+    sbs::io::logger("pending");
+    start = sbs::time::millis();
+    sbs::time::idleSleep(5);
+    TEST_ASSERT_TRUE(sbs::time::millis() - start >= 5);
+    TEST_ASSERT_EQUAL_STRING("pending", testHelper::capture.str().c_str());
+    SBS_END_REDIRECT_OUT
+}
@@ -7,9 +7,28 @@
  */
 #include "../test_base.h"
 #include "timing_utest.h"
+#include "scheduler_utest.h"
+#include "sleep_utest.h"
+#include "virtualtime_utest.h"
+#include "timerwheel_utest.h"
+#include "duration_utest.h"
+#include "profiler_utest.h"
+#include "loopmonitor_utest.h"
+#include "watchdog_utest.h"
 
 int runtest(){
     UNITY_BEGIN();
     RUN_TEST(timing);
+    RUN_TEST(scheduler_periodic_test);
+    RUN_TEST(scheduler_priority_test);
+    RUN_TEST(sleep_test);
+    RUN_TEST(virtualtime_test);
+    RUN_TEST(timerwheel_test);
+    RUN_TEST(timerwheel_stress_test);
+    RUN_TEST(duration_test);
+    RUN_TEST(monotonic_test);
+    RUN_TEST(profiler_test);
+    RUN_TEST(loopmonitor_test);
+    RUN_TEST(watchdog_test);
     return UNITY_END();
 }
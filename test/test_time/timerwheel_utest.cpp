@@ -0,0 +1,129 @@
+/**
+ * @file timerwheel_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/TimerWheel.h>
+
+/// Time of the fake clock
+static uint32_t wheelNow = 0;
+
+/**
+ * @brief Fake clock of the tests
+ * @return The fake time
+ */
+static uint32_t wheelClock() {
+    return wheelNow;
+}
+
+/**
+ * @brief Expiration record of a test timer
+ */
+struct Expected {
+    uint32_t date  = 0;///< Expected expiration time
+    uint16_t fired = 0;///< Number of expirations
+    bool late      = false;///< If an expiration happened at another time
+};
+
+/**
+ * @brief Timer callback checking its expiration date
+ * @param context The expiration record
+ */
+static void check(void* context) {
+    auto* expected = static_cast<Expected*>(context);
+    if (wheelNow != expected->date) expected->late = true;
+    ++expected->fired;
+}
+
+/**
+ * @brief Move the fake clock one millisecond at a time
+ * @param wheel The wheel to update
+ * @param milli Duration
+ */
+static void run(sbs::time::TimerWheel& wheel, uint32_t milli) {
+    for (uint32_t i = 0; i < milli; ++i) {
+        ++wheelNow;
+        wheel.update();
+    }
+}
+
+void timerwheel_test() {
+    static sbs::time::TimerWheel wheel;
+    wheelNow = 0xFFFFF000;// wraps during the test
+    wheel.setClock(&wheelClock);
+    TEST_ASSERT_EQUAL_UINT32(sbs::time::TimerWheel::forever, wheel.getIdle());
+    static Expected shortTimer;
+    static Expected longTimer;
+    static Expected cancelled;
+    shortTimer.date = wheelNow + 10;
+    longTimer.date  = wheelNow + 5000;
+    auto first      = wheel.start(10, &check, &shortTimer);
+    wheel.start(5000, &check, &longTimer);
+    auto third = wheel.start(20, &check, &cancelled);
+    TEST_ASSERT_EQUAL(3, wheel.getActiveCount());
+    TEST_ASSERT_EQUAL_UINT32(10, wheel.getIdle());
+    TEST_ASSERT_TRUE(wheel.cancel(third));
+    TEST_ASSERT_FALSE(wheel.cancel(third));
+    run(wheel, 9);
+    TEST_ASSERT_EQUAL(0, shortTimer.fired);
+    TEST_ASSERT_EQUAL_UINT32(1, wheel.getIdle());
+    run(wheel, 1);
+    TEST_ASSERT_EQUAL(1, shortTimer.fired);
+    TEST_ASSERT_FALSE(wheel.isActive(first));
+    // the idle time of a far timer is a lower bound
+    TEST_ASSERT_TRUE(wheel.getIdle() <= 4990);
+    run(wheel, 4990);
+    TEST_ASSERT_EQUAL(1, longTimer.fired);
+    TEST_ASSERT_FALSE(longTimer.late);
+    TEST_ASSERT_EQUAL(0, cancelled.fired);
+    // periodic timer, updated in big steps
+    static Expected periodic;
+    periodic.date = wheelNow + 100;
+    auto repeat   = wheel.start(100, &check, &periodic, 100);
+    for (uint8_t i = 0; i < 5; ++i) {
+        wheelNow += 100;
+        wheel.update();
+        periodic.date += 100;
+    }
+    TEST_ASSERT_EQUAL(5, periodic.fired);
+    TEST_ASSERT_FALSE(periodic.late);
+    TEST_ASSERT_TRUE(wheel.cancel(repeat));
+    // timer beyond the wheel range
+    static Expected far;
+    far.date = wheelNow + 20000000;
+    wheel.start(20000000, &check, &far);
+    wheelNow += 19999999;
+    wheel.update();
+    TEST_ASSERT_EQUAL(0, far.fired);
+    run(wheel, 1);
+    TEST_ASSERT_EQUAL(1, far.fired);
+    TEST_ASSERT_FALSE(far.late);
+    TEST_ASSERT_EQUAL(0, wheel.getActiveCount());
+}
+
+void timerwheel_stress_test() {
+    static sbs::time::TimerWheel wheel;
+    wheelNow = 0x7FFFF000;
+    wheel.setClock(&wheelClock);
+    static Expected timers[sbs::time::TimerWheel::maxTimers];
+    // pseudo random delays, all timers running at once
+    uint32_t seed = 12345;
+    for (auto& timer : timers) {
+        seed           = seed * 1103515245U + 12345U;
+        uint32_t delay = (seed >> 8) % 300000U;
+        timer.date     = wheelNow + delay;
+        TEST_ASSERT_NOT_EQUAL(sbs::time::TimerWheel::invalidTimer, wheel.start(delay, &check, &timer));
+    }
+    static Expected extra;
+    TEST_ASSERT_EQUAL(sbs::time::TimerWheel::invalidTimer, wheel.start(1, &check, &extra));
+    run(wheel, 300000);
+    for (const auto& timer : timers) {
+        TEST_ASSERT_EQUAL(1, timer.fired);
+        TEST_ASSERT_FALSE(timer.late);
+    }
+    TEST_ASSERT_EQUAL(0, wheel.getActiveCount());
+}
@@ -0,0 +1,72 @@
+/**
+ * @file virtualtime_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <io/i2c/utils.h>
+#include <sensor/Bme280.h>
+#include <time/Scheduler.h>
+#include <time/Sleep.h>
+
+#ifdef NATIVE
+/// Number of runs of the test task
+static uint16_t runs = 0;
+
+/**
+ * @brief Task counting its runs
+ */
+static void countRuns(void*) {
+    ++runs;
+}
+#endif
+
+void virtualtime_test() {
+#ifdef NATIVE
+    TEST_ASSERT_FALSE(sbs::time::isVirtualTime());
+    sbs::time::setVirtualTime(true);
+    TEST_ASSERT_TRUE(sbs::time::isVirtualTime());
+    // the clock only moves when asked to
+    sbs::time::setTime(5000);
+    TEST_ASSERT_EQUAL_UINT32(5, sbs::time::millis());
+    TEST_ASSERT_EQUAL_UINT32(5000, sbs::time::micros());
+    sbs::time::delay(10000);
+    sbs::time::delayMicroseconds(250);
+    TEST_ASSERT_EQUAL_UINT32(10005, sbs::time::millis());
+    TEST_ASSERT_TRUE(sbs::time::micros64() == 10005250U);
+    sbs::time::advance(750);
+    TEST_ASSERT_EQUAL_UINT32(10006, sbs::time::millis());
+    // one simulated day of a scheduler in no time
+    sbs::time::Scheduler scheduler;
+    scheduler.setIdleHook(&sbs::time::idleSleep);
+    scheduler.addPeriodic("count", 10000, &countRuns);
+    runs = 0;
+    const uint32_t end = sbs::time::millis() + 86400000U;
+    while (static_cast<int32_t>(sbs::time::millis() - end) <= 0)
+        scheduler.update();
+    TEST_ASSERT_EQUAL_UINT16(8640, runs);
+    TEST_ASSERT_EQUAL_UINT16(0, scheduler.getMissed(0));
+    // a blocking driver read waits in virtual time
+    sbs::sensor::BME280 device;
+    sbs::io::i2c::setEmulatedMode(true);
+    uint8_t identity[] = {0x60, 0x60};
+    sbs::io::i2c::setEmulatedBuffer(2, identity);
+    device.selfCheck();
+    TEST_ASSERT_TRUE(device.presence());
+    // status busy once, then the measurement
+    uint8_t measure[] = {0x01, 0x00, 0x52, 0x6C, 0x00, 0x84, 0xF8, 0x00, 0x61, 0x41};
+    sbs::io::i2c::setEmulatedBuffer(10, measure);
+    const uint32_t start = sbs::time::millis();
+    (void) device.getValue();
+    const uint32_t waited = sbs::time::millis() - start;
+    TEST_ASSERT_TRUE(waited >= device.getSetting().maxMeasurementTime());
+    TEST_ASSERT_TRUE(waited <= device.getSetting().maxMeasurementTime() + 1U);
+    sbs::io::i2c::setEmulatedMode(false);
+    // back to the real clock
+    sbs::time::setVirtualTime(false);
+    TEST_ASSERT_FALSE(sbs::time::isVirtualTime());
+#endif
+}
@@ -0,0 +1,74 @@
+/**
+ * @file watchdog_utest.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "../test_helper.h"
+#include <time/Watchdog.h>
+
+/// Time of the fake clock
+static uint32_t watchdogNow = 0;
+/// Number of resets
+static uint8_t resets = 0;
+
+/**
+ * @brief Fake clock of the test
+ * @return The fake time
+ */
+static uint32_t watchdogClock() {
+    return watchdogNow;
+}
+
+/**
+ * @brief Fake reset of the board
+ */
+static void countReset() {
+    ++resets;
+}
+
+void watchdog_test() {
+#ifdef NATIVE
+    static sbs::time::Watchdog watchdog;
+    sbs::time::ResetRecord record{};
+    TEST_ASSERT_FALSE(sbs::time::Watchdog::getLastReset(record));
+    watchdogNow = 0xFFFFFF00;// wraps during the test
+    watchdog.setClock(&watchdogClock);
+    watchdog.setResetHandler(&countReset);
+    const auto sensor = watchdog.add("sensor", 100);
+    const auto radio  = watchdog.add("radio", 1000);
+    TEST_ASSERT_NOT_EQUAL(sbs::time::Watchdog::invalidClient, radio);
+    // registered again (setup run after a restart): same client
+    TEST_ASSERT_EQUAL(radio, watchdog.add("radio", 1000));
+    watchdog.start();
+    TEST_ASSERT_TRUE(watchdog.isStarted());
+    // the clients check in within their deadlines
+    for (uint8_t i = 0; i < 20; ++i) {
+        watchdogNow += 50;
+        watchdog.checkIn(sensor);
+        if (i % 10 == 0) watchdog.checkIn(radio);
+        watchdog.update();
+    }
+    TEST_ASSERT_EQUAL(0, resets);
+    TEST_ASSERT_NULL(watchdog.findLate());
+    // the sensor stops checking in
+    watchdogNow += 101;
+    TEST_ASSERT_EQUAL_STRING("sensor", watchdog.findLate());
+    sbs::io::setVerbosity(sbs::io::Verbosity::Mute);
+    watchdog.update();
+    sbs::io::setVerbosity(sbs::io::Verbosity::Error);
+    TEST_ASSERT_EQUAL(1, resets);
+    TEST_ASSERT_TRUE(sbs::time::Watchdog::getLastReset(record));
+    TEST_ASSERT_TRUE(record.cause == sbs::time::ResetCause::Deadline);
+    TEST_ASSERT_EQUAL_STRING("sensor", record.culprit);
+    // the record is read once
+    TEST_ASSERT_FALSE(sbs::time::Watchdog::getLastReset(record));
+    // a removed client is not watched
+    watchdog.remove(sensor);
+    watchdogNow += 500;
+    watchdog.update();
+    TEST_ASSERT_EQUAL(1, resets);
+#endif
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+Extraction of the SBS_BLOG format strings and decoding of binary log streams.
+
+    logdecode.py extract <source dirs...> -o logformats.json
+    logdecode.py decode [-d logformats.json] [-s <source dir>]... [input]
+
+The input of decode is a file, a serial port (needs pyserial) or stdin. Text outside
+records is passed through unchanged.
+"""
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+HEADER_SIZE = 7
+TRUNCATED = 0x80
+TIME_STAMPED = 0x40
+SEQUENCED = 0x20
+LEVELS = ["", "ERROR ", "WARNING ", "DEBUG "]
+SOURCE_EXTENSIONS = (".h", ".hpp", ".c", ".cpp", ".ino")
+CALL = re.compile(r'SBS_BLOG\s*\(\s*[^,]+,\s*((?:"(?:[^"\\]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\]|\\.)*)"')
+PLACEHOLDER = re.compile(r"\{([^}]*)\}")
+
+
+def format_id(text):
+    """32 bits FNV-1a, as sbs::io::formatId."""
+    value = 2166136261
+    for byte in text.encode("utf-8"):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def unescape(literal):
+    return literal.encode("utf-8").decode("unicode_escape").encode("latin-1").decode("utf-8")
+
+
+def extract(paths):
+    """Search the format strings in the sources, return {id: format}."""
+    formats = {}
+    for path in paths:
+        for root, _, files in os.walk(path):
+            for name in sorted(files):
+                if not name.endswith(SOURCE_EXTENSIONS) or name == "BinaryLog.h":
+                    continue
+                with open(os.path.join(root, name), encoding="utf-8", errors="replace") as source:
+                    content = source.read()
+                for match in CALL.finditer(content):
+                    text = "".join(unescape(part) for part in LITERAL.findall(match.group(1)))
+                    ident = format_id(text)
+                    if formats.get(ident, text) != text:
+                        raise ValueError("format id collision: '%s' and '%s'" % (formats[ident], text))
+                    formats[ident] = text
+    return formats
+
+
+def write_dictionary(paths, output):
+    formats = extract(paths)
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "w", encoding="utf-8") as out:
+        json.dump({"%08X" % key: value for key, value in sorted(formats.items())}, out, indent=1)
+    return formats
+
+
+def read_dictionary(path):
+    with open(path, encoding="utf-8") as source:
+        return {int(key, 16): value for key, value in json.load(source).items()}
+
+
+def format_float(value, digits):
+    return "%.*f" % (digits, value)
+
+
+def parse_arguments(payload):
+    """Return the list of (kind, value) of a payload."""
+    arguments = []
+    pos = 0
+    while pos < len(payload):
+        kind = payload[pos] & 0xF0
+        size = payload[pos] & 0x0F
+        pos += 1
+        if kind == 0x30:
+            size = payload[pos]
+            arguments.append(("s", payload[pos + 1:pos + 1 + size].decode("utf-8", errors="replace")))
+            pos += 1 + size
+            continue
+        raw = payload[pos:pos + size]
+        pos += size
+        if kind == 0x20:
+            arguments.append(("f", struct.unpack("<f" if size == 4 else "<d", raw)[0]))
+        else:
+            arguments.append(("i", int.from_bytes(raw, "little", signed=kind == 0x10), size))
+    return arguments
+
+
+def render_argument(argument, spec):
+    if argument[0] == "s":
+        return argument[1]
+    if argument[0] == "f":
+        digits = int(spec[1]) if spec.startswith(".") and spec[1:2].isdigit() else 2
+        return format_float(argument[1], digits)
+    value, size = argument[1], argument[2]
+    if spec in ("x", "b"):
+        value &= (1 << (8 * size)) - 1
+        return ("%0*X" % (2 * size, value)) if spec == "x" else format(value, "0%db" % (8 * size))
+    return str(value)
+
+
+def render(record, formats):
+    level = record[1] & 0x03
+    ident = struct.unpack("<I", record[2:6])[0]
+    payload = record[HEADER_SIZE:HEADER_SIZE + record[6]]
+    stamps = ""
+    if record[1] & TIME_STAMPED:
+        now = struct.unpack("<Q", payload[:8])[0]
+        stamps += "[%d.%06d] " % (now // 1000000, now % 1000000)
+        payload = payload[8:]
+    if record[1] & SEQUENCED:
+        stamps += "#%d " % struct.unpack("<H", payload[:2])[0]
+        payload = payload[2:]
+    arguments = parse_arguments(payload)
+    text = formats.get(ident)
+    if text is None:
+        line = "#%08X" % ident
+    else:
+        line = ""
+        pos = 0
+        for match in PLACEHOLDER.finditer(text):
+            line += text[pos:match.start()]
+            pos = match.end()
+            if arguments:
+                line += render_argument(arguments.pop(0), match.group(1))
+        line += text[pos:]
+    for argument in arguments:
+        line += " " + render_argument(argument, "")
+    if record[1] & TRUNCATED:
+        line += " [...]"
+    return stamps + LEVELS[level] + line + "\n"
+
+
+def decode(stream, formats, output):
+    """Decode a byte stream, text outside records is passed through."""
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        buffer += chunk
+        while buffer:
+            if buffer[0] != SYNC:
+                end = buffer.find(bytes([SYNC]))
+                text, buffer = (buffer, bytearray()) if end < 0 else (buffer[:end], buffer[end:])
+                output.write(text.decode("utf-8", errors="replace"))
+                continue
+            if len(buffer) < HEADER_SIZE or len(buffer) < HEADER_SIZE + buffer[6] + 1:
+                break
+            size = HEADER_SIZE + buffer[6] + 1
+            record = bytes(buffer[:size])
+            if sum(record[1:size - 1]) & 0xFF != record[size - 1]:
+                # not a record: output the byte as text and resynchronize
+                output.write(bytes(buffer[:1]).decode("latin-1"))
+                del buffer[:1]
+                continue
+            output.write(render(record, formats))
+            del buffer[:size]
+        output.flush()
+    if buffer:
+        output.write(buffer.decode("utf-8", errors="replace"))
+
+
+def open_input(name, baud):
+    if name is None or name == "-":
+        return sys.stdin.buffer
+    if os.path.exists(name) and not name.startswith("/dev/"):
+        return open(name, "rb")
+    import serial  # pylint: disable=import-outside-toplevel
+    return serial.Serial(name, baud)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+    extract_parser = commands.add_parser("extract", help="build the format dictionary")
+    extract_parser.add_argument("sources", nargs="+")
+    extract_parser.add_argument("-o", "--output", default="logformats.json")
+    decode_parser = commands.add_parser("decode", help="decode a binary log stream")
+    decode_parser.add_argument("input", nargs="?")
+    decode_parser.add_argument("-d", "--dictionary")
+    decode_parser.add_argument("-s", "--sources", action="append", help="source directory (repeatable)")
+    decode_parser.add_argument("-b", "--baud", type=int, default=115200)
+    args = parser.parse_args()
+    if args.command == "extract":
+        formats = write_dictionary(args.sources, args.output)
+        print("%d format strings written to %s" % (len(formats), args.output))
+        return
+    formats = {}
+    if args.dictionary:
+        formats.update(read_dictionary(args.dictionary))
+    if args.sources:
+        formats.update(extract(args.sources))
+    decode(open_input(args.input, args.baud), formats, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()